@@ -0,0 +1,218 @@
+/*!
+	\file delegateBenchmarks.cpp
+
+	Measures costs of Delegate's subscription, unsubscription and notification for different numbers of listeners.
+	The file is built twice, with DELEGATE_ENABLE_THREAD_SAFENESS enabled and disabled, concurrent benchmarks are
+	run by the thread-safe build only. Results are printed as a table, nanoseconds per operation.
+*/
+
+#include "delegate.hpp"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+
+using namespace Wrench;
+
+
+namespace
+{
+	using TClock = std::chrono::steady_clock;
+
+	constexpr size_t ListenersCounts[] = { 1, 10, 100, 1000, 10000 };
+	constexpr size_t ListenerCallsPerBenchmark = 10000000;	///< Notify benchmarks invoke roughly the given number of listeners
+
+	thread_local uint64_t ListenerCallsCount = 0;	///< Thread local, so concurrent listeners don't race for it
+
+	void IncrementCounter(int value)
+	{
+		ListenerCallsCount += static_cast<uint64_t>(value);
+	}
+
+
+	template <typename TAction>
+	double MeasureNanoseconds(TAction&& action)
+	{
+		const auto startTime = TClock::now();
+		action();
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(TClock::now() - startTime).count());
+	}
+
+	void PrintResult(const std::string& name, size_t listenersCount, double nanosecondsPerOp)
+	{
+		std::printf("%-48s %10zu %14.2f\n", name.c_str(), listenersCount, nanosecondsPerOp);
+	}
+
+
+	template <typename TListener>
+	void BenchmarkSubscribeUnsubscribe(const char* pName, const TListener& listener)
+	{
+		for (size_t listenersCount : ListenersCounts)
+		{
+			Delegate<int> delegate;
+			std::vector<TSubscriptionHandle> handles(listenersCount);
+
+			const size_t repeatsCount = (std::max)(static_cast<size_t>(1), static_cast<size_t>(100000) / listenersCount);
+
+			double subscribeTime = 0.0;
+			double unsubscribeTime = 0.0;
+
+			for (size_t i = 0; i < repeatsCount; ++i)
+			{
+				subscribeTime += MeasureNanoseconds([&]
+				{
+					for (size_t j = 0; j < listenersCount; ++j)
+					{
+						handles[j] = delegate.Subscribe(listener);
+					}
+				});
+
+				unsubscribeTime += MeasureNanoseconds([&]
+				{
+					for (size_t j = 0; j < listenersCount; ++j)
+					{
+						delegate.Unsubscribe(handles[j]);
+					}
+				});
+			}
+
+			const double opsCount = static_cast<double>(repeatsCount * listenersCount);
+
+			PrintResult(std::string("Subscribe/") + pName, listenersCount, subscribeTime / opsCount);
+			PrintResult(std::string("Unsubscribe/") + pName, listenersCount, unsubscribeTime / opsCount);
+		}
+	}
+
+	template <typename TListener>
+	void BenchmarkNotify(const char* pName, const TListener& listener)
+	{
+		for (size_t listenersCount : ListenersCounts)
+		{
+			Delegate<int> delegate;
+
+			for (size_t i = 0; i < listenersCount; ++i)
+			{
+				delegate.Subscribe(listener);
+			}
+
+			const size_t notificationsCount = ListenerCallsPerBenchmark / listenersCount;
+
+			const double time = MeasureNanoseconds([&]
+			{
+				for (size_t i = 0; i < notificationsCount; ++i)
+				{
+					delegate.Notify(1);
+				}
+			});
+
+			PrintResult(std::string("Notify/") + pName, listenersCount, time / static_cast<double>(notificationsCount));
+		}
+	}
+
+#if DELEGATE_ENABLE_THREAD_SAFENESS
+	/// \note Each of threads notifies the same delegate, optionally another thread keeps subscribing and unsubscribing
+	void BenchmarkConcurrentNotify(const char* pName, size_t notifiersCount, bool hasSubscriber)
+	{
+		for (size_t listenersCount : ListenersCounts)
+		{
+			Delegate<int> delegate;
+
+			for (size_t i = 0; i < listenersCount; ++i)
+			{
+				delegate.Subscribe(&IncrementCounter);
+			}
+
+			const size_t notificationsCount = (std::max)(static_cast<size_t>(100), ListenerCallsPerBenchmark / (listenersCount * notifiersCount));
+
+			std::atomic<bool> isRunning { true };
+			std::atomic<uint64_t> subscriptionsCount { 0 };
+
+			std::thread subscriberThread;
+
+			if (hasSubscriber)
+			{
+				subscriberThread = std::thread([&]
+				{
+					while (isRunning.load(std::memory_order_relaxed))
+					{
+						delegate.Unsubscribe(delegate.Subscribe(&IncrementCounter));
+						subscriptionsCount.fetch_add(1, std::memory_order_relaxed);
+					}
+				});
+			}
+
+			const double time = MeasureNanoseconds([&]
+			{
+				std::vector<std::thread> notifiers;
+
+				for (size_t i = 0; i < notifiersCount; ++i)
+				{
+					notifiers.emplace_back([&]
+					{
+						for (size_t j = 0; j < notificationsCount; ++j)
+						{
+							delegate.Notify(1);
+						}
+					});
+				}
+
+				for (auto&& currThread : notifiers)
+				{
+					currThread.join();
+				}
+			});
+
+			isRunning = false;
+
+			if (subscriberThread.joinable())
+			{
+				subscriberThread.join();
+			}
+
+			/// \note The wall time per a single notification of all threads, so the ideal scaling divides it by notifiersCount
+			PrintResult(pName, listenersCount, time / static_cast<double>(notificationsCount * notifiersCount));
+
+			if (hasSubscriber)
+			{
+				PrintResult("  subscriptions per notification", listenersCount,
+					static_cast<double>(subscriptionsCount.load()) / static_cast<double>(notificationsCount * notifiersCount));
+			}
+		}
+	}
+#endif
+}
+
+
+int main()
+{
+	std::printf("Delegate benchmarks, DELEGATE_ENABLE_THREAD_SAFENESS=%d, DELEGATE_ENABLE_LOCK_FREE_NOTIFY=%d\n\n",
+		DELEGATE_ENABLE_THREAD_SAFENESS, DELEGATE_LOCK_FREE_NOTIFY_ENABLED);
+	std::printf("%-48s %10s %14s\n", "Benchmark", "Listeners", "ns/op");
+
+	void (*pFunction)(int) = &IncrementCounter;
+	const std::function<void(int)> function = &IncrementCounter;
+	const auto lambda = [](int value) { ListenerCallsCount += static_cast<uint64_t>(value); };
+
+	BenchmarkSubscribeUnsubscribe("FunctionPointer", pFunction);
+	BenchmarkSubscribeUnsubscribe("StdFunction", function);
+
+	BenchmarkNotify("FunctionPointer", pFunction);
+	BenchmarkNotify("StdFunction", function);
+	BenchmarkNotify("Lambda", lambda);
+
+#if DELEGATE_ENABLE_THREAD_SAFENESS
+	const size_t notifiersCount = (std::max)(2u, std::thread::hardware_concurrency() / 2);
+
+	BenchmarkConcurrentNotify("ConcurrentNotify", notifiersCount, false);
+	BenchmarkConcurrentNotify("ConcurrentNotifyWithSubscriber", notifiersCount, true);
+#endif
+
+	/// \note Prevents the compiler from throwing listeners' work away
+	std::printf("\nListeners of the main thread were invoked %llu times\n", static_cast<unsigned long long>(ListenerCallsCount));
+
+	return 0;
+}
@@ -20,16 +20,55 @@
 
 
 #include <cassert>
+#include <cstdint>
+#include <cstddef>
 #include <functional>
 #include <vector>
+#include <memory>
 #include <algorithm>
 #include <limits>
+#include <type_traits>
+#include <tuple>
+#include <utility>
+#include <new>
 
 
 ///< Library's configs
-#define DELEGATE_DISABLE_EXCEPTIONS 1
-#define DELEGATE_ENABLE_EXPORT 1
-#define DELEGATE_ENABLE_THREAD_SAFENESS 1
+#if !defined(DELEGATE_DISABLE_EXCEPTIONS)
+	#define DELEGATE_DISABLE_EXCEPTIONS 1
+#endif
+
+#if !defined(DELEGATE_ENABLE_EXPORT)
+	#define DELEGATE_ENABLE_EXPORT 1
+#endif
+
+#if !defined(DELEGATE_ENABLE_THREAD_SAFENESS)
+	#define DELEGATE_ENABLE_THREAD_SAFENESS 1
+#endif
+
+#if !defined(DELEGATE_ENABLE_LOCK_FREE_NOTIFY)
+	#define DELEGATE_ENABLE_LOCK_FREE_NOTIFY 1	///< Notify reads an immutable snapshot of listeners without locking, requires DELEGATE_ENABLE_THREAD_SAFENESS
+#endif
+
+#if !defined(DELEGATE_LISTENER_INLINE_STORAGE_SIZE)
+	#define DELEGATE_LISTENER_INLINE_STORAGE_SIZE (6 * sizeof(void*))	///< Max size of a listener's captured state, bigger ones are rejected at compile time
+#endif
+
+#if !defined(DELEGATE_LISTENERS_CHUNK_SIZE)
+	#define DELEGATE_LISTENERS_CHUNK_SIZE 64	///< Listeners are allocated by chunks of the given size
+#endif
+
+#if !defined(DELEGATE_ENABLE_PROFILING)
+	#define DELEGATE_ENABLE_PROFILING 0	///< Notify measures each listener's calls, the instrumentation is compiled out if disabled
+#endif
+
+#if !defined(DELEGATE_EXPIRED_LISTENERS_PRUNE_THRESHOLD)
+	#define DELEGATE_EXPIRED_LISTENERS_PRUNE_THRESHOLD 8	///< Listeners of dead owners are removed when Notify meets them the given number of times
+#endif
+
+#if !defined(DELEGATE_QUEUE_DISPATCH_BATCH_SIZE)
+	#define DELEGATE_QUEUE_DISPATCH_BATCH_SIZE 64	///< QueuedDelegate takes up to the given number of events from its queue at once
+#endif
 
 
 #if DELEGATE_DISABLE_EXCEPTIONS
@@ -73,215 +112,2498 @@
 #define WRENCH_ASSERT(condition) assert(condition) 
 #define WRENCH_UNREACHABLE() do { assert(false); } while(false)
 
+#if DELEGATE_ENABLE_THREAD_SAFENESS && DELEGATE_ENABLE_LOCK_FREE_NOTIFY
+	#define DELEGATE_LOCK_FREE_NOTIFY_ENABLED 1
+#else
+	#define DELEGATE_LOCK_FREE_NOTIFY_ENABLED 0
+#endif
+
+#include <chrono>
+#include <unordered_map>
+
 #if DELEGATE_ENABLE_THREAD_SAFENESS
+	#include <atomic>
 	#include <mutex>
-
-	#define DELEGATE_LOCK_THREAD std::lock_guard<std::mutex> lock(mMutex)
-	#define DELEGATE_DECLARE_OBJECT_MUTEX mutable std::mutex mMutex
+	#include <condition_variable>
+	#include <thread>
+
+	#if DELEGATE_LOCK_FREE_NOTIFY_ENABLED
+		#define DELEGATE_LOCK_THREAD std::lock_guard<std::mutex> lock(mMutex)
+		#define DELEGATE_DECLARE_OBJECT_MUTEX mutable std::mutex mMutex
+	#else
+		/// \note Notify holds the lock, so listeners should be able to take it again to modify the delegate
+		#define DELEGATE_LOCK_THREAD std::lock_guard<std::recursive_mutex> lock(mMutex)
+		#define DELEGATE_DECLARE_OBJECT_MUTEX mutable std::recursive_mutex mMutex
+	#endif
 #else
 	#define DELEGATE_LOCK_THREAD
 	#define DELEGATE_DECLARE_OBJECT_MUTEX
 #endif
 
+#if DELEGATE_ENABLE_PROFILING
+	#include <atomic>
+
+	#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		#include <intrin.h>
+		#define DELEGATE_HAS_RDTSC 1
+	#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+		#include <x86intrin.h>
+		#define DELEGATE_HAS_RDTSC 1
+	#else
+		#include <chrono>
+		#define DELEGATE_HAS_RDTSC 0
+	#endif
+#endif
+
 
 namespace Wrench
 {
-	enum class TSubscriptionHandle : uint32_t { Invalid = (std::numeric_limits<uint32_t>::max)() };
+	/// \note The lower half of a handle is an index of a listener, the upper one is a generation of its slot
+	enum class TSubscriptionHandle : uint64_t { Invalid = (std::numeric_limits<uint64_t>::max)() };
 
 
-	template <typename... TArgs>
-	class Delegate final
+#if DELEGATE_ENABLE_PROFILING
+	/// \note Returns the CPU's timestamp counter, nanoseconds of a steady clock are used on platforms without it
+	inline uint64_t GetCpuCyclesCount() DELEGATE_NOEXCEPT
+	{
+	#if DELEGATE_HAS_RDTSC
+		return static_cast<uint64_t>(__rdtsc());
+	#else
+		return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	#endif
+	}
+
+
+	struct TDelegateListenerStats
+	{
+		uint64_t mCallsCount = 0;
+		uint64_t mTotalCycles = 0;
+		uint64_t mMaxCycles = 0;
+	};
+#endif
+
+
+	/// \note The functions tell whether a callable is a null pointer or an empty std::function
+	template <typename T> bool IsNullCallable(const T&) DELEGATE_NOEXCEPT { return false; }
+	template <typename T> bool IsNullCallable(T* pCallable) DELEGATE_NOEXCEPT { return !pCallable; }
+	template <typename T> bool IsNullCallable(const std::function<T>& callable) DELEGATE_NOEXCEPT { return !callable; }
+
+
+	template <typename TSignature, size_t StorageSize = DELEGATE_LISTENER_INLINE_STORAGE_SIZE> class InlineFunction;
+
+
+	/*!
+		class InlineFunction
+
+		\brief A move-only type-erased callable that keeps its target within a fixed-size inline buffer.
+
+		The class never allocates memory. Callables that don't fit into the buffer are rejected at compile time.
+		Trivially copyable callables (function pointers, lambdas that capture references) are moved via plain copy
+		of the buffer.
+	*/
+
+	template <typename TResult, typename... TArgs, size_t StorageSize>
+	class InlineFunction<TResult(TArgs...), StorageSize> final
 	{
 		public:
-			Delegate() DELEGATE_NOEXCEPT 
-				: mFirstFreeEntityIndex((std::numeric_limits<size_t>::max)()) {}
-			~Delegate() DELEGATE_NOEXCEPT { UnsubscribeAll(); }
+			using TStorageType = typename std::aligned_storage<StorageSize, alignof(std::max_align_t)>::type;
+			using TInvokeFunction = TResult(*)(void*, TArgs&&...);
+			using TManageFunction = void(*)(void*, void*);
 
-			TSubscriptionHandle Subscribe(std::function<void(TArgs...)> listener) DELEGATE_NOEXCEPT
+		public:
+			InlineFunction() DELEGATE_NOEXCEPT : mpInvoke(nullptr), mpManage(nullptr) {}
+			InlineFunction(std::nullptr_t) DELEGATE_NOEXCEPT : mpInvoke(nullptr), mpManage(nullptr) {}
+
+			template <typename TCallable, typename = typename std::enable_if<!std::is_same<typename std::decay<TCallable>::type, InlineFunction>::value>::type>
+			InlineFunction(TCallable&& callable) DELEGATE_NOEXCEPT :
+				mpInvoke(nullptr), mpManage(nullptr)
 			{
-				DELEGATE_LOCK_THREAD;
+				using TFunctor = typename std::decay<TCallable>::type;
 
-				if (!listener)
+				static_assert(sizeof(TFunctor) <= StorageSize, "[InlineFunction] The callable doesn't fit into the inline storage");
+				static_assert(alignof(TFunctor) <= alignof(TStorageType), "[InlineFunction] The callable's alignment isn't supported");
+
+				if (IsNullCallable(callable))
 				{
-					return TSubscriptionHandle::Invalid;
+					return;
 				}
 
-#if 0 /// \todo
-				auto it = std::find_if(mListeners.cbegin(), mListeners.cend(), [&listener](auto&& currEntity)
-				{
-					return reinterpret_cast<uintptr_t>(currEntity.target()) == reinterpret_cast<uintptr_t>(listener.target());
-				});
-				if (it != mListeners.cend())
+				new (&mStorage) TFunctor(std::forward<TCallable>(callable));
+
+				mpInvoke = &_invoke<TFunctor>;
+				mpManage = (std::is_trivially_copyable<TFunctor>::value && std::is_trivially_destructible<TFunctor>::value) ? nullptr : &_manage<TFunctor>;
+			}
+
+			InlineFunction(InlineFunction&& function) DELEGATE_NOEXCEPT :
+				mpInvoke(nullptr), mpManage(nullptr)
+			{
+				_moveFrom(function);
+			}
+
+			~InlineFunction() DELEGATE_NOEXCEPT
+			{
+				_reset();
+			}
+
+			InlineFunction& operator= (InlineFunction&& function) DELEGATE_NOEXCEPT
+			{
+				if (this != &function)
 				{
-					return static_cast<TSubscriptionHandle>(std::distance(mListeners.cbegin(), it)); /// \note The listener's already been registered so return its handle
+					_reset();
+					_moveFrom(function);
 				}
-#endif
 
-				if (mFirstFreeEntityIndex < mListeners.size())
-				{
-					mListeners[mFirstFreeEntityIndex] = std::move(listener);
-					auto result = static_cast<TSubscriptionHandle>(mFirstFreeEntityIndex);
+				return *this;
+			}
 
-					mFirstFreeEntityIndex = mListeners.size();
+			InlineFunction& operator= (std::nullptr_t) DELEGATE_NOEXCEPT
+			{
+				_reset();
+				return *this;
+			}
 
-					return result;
-				}
+			TResult operator()(TArgs... args) const
+			{
+				WRENCH_ASSERT(mpInvoke);
+				return mpInvoke(&mStorage, std::forward<TArgs>(args)...);
+			}
 
-				mListeners.emplace_back(listener);
+			explicit operator bool() const DELEGATE_NOEXCEPT { return mpInvoke != nullptr; }
 
-				return static_cast<TSubscriptionHandle>(mListeners.size() - 1);
+			/// \note Returns nullptr if the stored callable's type differs from the given one
+			template <typename T>
+			T* GetTarget() const DELEGATE_NOEXCEPT
+			{
+				return (mpInvoke == &_invoke<T>) ? reinterpret_cast<T*>(&mStorage) : nullptr;
 			}
 
-			bool Unsubscribe(TSubscriptionHandle subscriptionHandle) DELEGATE_NOEXCEPT
+			InlineFunction(const InlineFunction&) = delete;
+			InlineFunction& operator= (const InlineFunction&) = delete;
+		private:
+			template <typename TFunctor>
+			static TResult _invoke(void* pStorage, TArgs&&... args)
 			{
-				DELEGATE_LOCK_THREAD;
+				return (*static_cast<TFunctor*>(pStorage))(std::forward<TArgs>(args)...);
+			}
 
-				size_t index = static_cast<size_t>(subscriptionHandle);
-				if (index >= mListeners.size())
+			/// \note Move-constructs the callable from pSrc into pDest if pSrc isn't null, otherwise destroys pDest
+			template <typename TFunctor>
+			static void _manage(void* pDest, void* pSrc) DELEGATE_NOEXCEPT
+			{
+				if (pSrc)
 				{
-					WRENCH_ASSERT(false);
-					return false;
+					new (pDest) TFunctor(std::move(*static_cast<TFunctor*>(pSrc)));
+					static_cast<TFunctor*>(pSrc)->~TFunctor();
+
+					return;
+				}
+
+				static_cast<TFunctor*>(pDest)->~TFunctor();
+			}
+
+			void _moveFrom(InlineFunction& function) DELEGATE_NOEXCEPT
+			{
+				if (!function.mpInvoke)
+				{
+					return;
 				}
 
-				if (!mListeners[index])
+				if (function.mpManage)
 				{
-					return false;
+					function.mpManage(&mStorage, &function.mStorage);
+				}
+				else
+				{
+					mStorage = function.mStorage;
 				}
 
-				mListeners[index] = nullptr;
-				mFirstFreeEntityIndex = static_cast<size_t>(subscriptionHandle);
+				mpInvoke = function.mpInvoke;
+				mpManage = function.mpManage;
 
-				return true;
+				function.mpInvoke = nullptr;
+				function.mpManage = nullptr;
 			}
 
-			void UnsubscribeAll() DELEGATE_NOEXCEPT
+			void _reset() DELEGATE_NOEXCEPT
 			{
-				DELEGATE_LOCK_THREAD;
+				if (mpManage)
+				{
+					mpManage(&mStorage, nullptr);
+				}
 
-				mFirstFreeEntityIndex = (std::numeric_limits<size_t>::max)();
-				mListeners.clear(); 
+				mpInvoke = nullptr;
+				mpManage = nullptr;
 			}
 
-			void Notify(TArgs&&... args) DELEGATE_NOEXCEPT
-			{
-				DELEGATE_LOCK_THREAD;
+		private:
+			mutable TStorageType mStorage;
+
+			TInvokeFunction mpInvoke;
+			TManageFunction mpManage;
+	};
+
+
+	/*!
+		\brief Bindings of methods to their objects, both are much cheaper than std::bind
+	*/
+
+	template <typename TClass, typename TMethod>
+	struct TMemberFunctionBinding
+	{
+		template <typename... TArgs>
+		decltype(auto) operator()(TArgs&&... args) const { return (mpObject->*mpMethod)(std::forward<TArgs>(args)...); }
+
+		TClass* mpObject;
+		TMethod mpMethod;
+	};
+
+
+	template <typename TMethod, TMethod pMethod, typename TClass>
+	struct TStaticMemberFunctionBinding
+	{
+		template <typename... TArgs>
+		decltype(auto) operator()(TArgs&&... args) const { return (mpObject->*pMethod)(std::forward<TArgs>(args)...); }
+
+		TClass* mpObject;
+	};
+
+
+	/// \note A free function known at compile time, e.g. TStaticFunctionBinding<void(int), &Foo>
+	template <typename TFunction, TFunction* pFunction>
+	struct TStaticFunctionBinding
+	{
+		template <typename... TArgs>
+		decltype(auto) operator()(TArgs&&... args) const { return pFunction(std::forward<TArgs>(args)...); }
+	};
+
+
+	/*!
+		\brief A non-owning view of a contiguous sequence of elements
+	*/
+
+	template <typename T>
+	struct TSpan
+	{
+		TSpan() DELEGATE_NOEXCEPT : mpData(nullptr), mSize(0) {}
+		TSpan(const T* pData, size_t size) DELEGATE_NOEXCEPT : mpData(pData), mSize(size) {}
+		TSpan(const std::vector<T>& elements) DELEGATE_NOEXCEPT : mpData(elements.data()), mSize(elements.size()) {}
+
+		const T* begin() const DELEGATE_NOEXCEPT { return mpData; }
+		const T* end() const DELEGATE_NOEXCEPT { return mpData + mSize; }
+
+		const T& operator[] (size_t index) const DELEGATE_NOEXCEPT
+		{
+			WRENCH_ASSERT(index < mSize);
+			return mpData[index];
+		}
+
+		size_t GetSize() const DELEGATE_NOEXCEPT { return mSize; }
+		bool IsEmpty() const DELEGATE_NOEXCEPT { return !mSize; }
+
+		const T* mpData;
+		size_t mSize;
+	};
+
+
+	/*!
+		\brief The type describes a single event of a delegate which is used by batched notifications. 
+		It's a plain value for delegates with a single argument, otherwise it's a tuple of all arguments
+	*/
+
+	template <typename... TArgs>
+	struct TDelegateEventTraits
+	{
+		using TEvent = std::tuple<typename std::decay<TArgs>::type...>;
+
+		template <typename TCallable>
+		static void Invoke(TCallable& callable, const TEvent& event) { _invoke(callable, event, std::index_sequence_for<TArgs...>()); }
+
+		template <typename TCallable, size_t... Indices>
+		static void _invoke(TCallable& callable, const TEvent& event, std::index_sequence<Indices...>) { callable(std::get<Indices>(event)...); }
+	};
+
+	template <typename TArg>
+	struct TDelegateEventTraits<TArg>
+	{
+		using TEvent = typename std::decay<TArg>::type;
+
+		template <typename TCallable>
+		static void Invoke(TCallable& callable, const TEvent& event) { callable(event); }
+	};
+
+
+	/*!
+		class ChunkedArray
+
+		\brief The array allocates its elements by chunks, so they never move in memory while the array grows
+	*/
 
-				for (auto&& currListener : mListeners)
+	template <typename T, size_t ChunkSize = DELEGATE_LISTENERS_CHUNK_SIZE>
+	class ChunkedArray final
+	{
+		public:
+			ChunkedArray() DELEGATE_NOEXCEPT : mSize(0) {}
+
+			void Reserve(size_t capacity) DELEGATE_NOEXCEPT
+			{
+				while (mChunks.size() * ChunkSize < capacity)
 				{
-					if (currListener)
-					{
-						currListener(std::forward<TArgs>(args)...);
-					}
+					mChunks.emplace_back(new T[ChunkSize]);
 				}
 			}
 
-			void operator()(TArgs&&... args) DELEGATE_NOEXCEPT { Notify(std::forward<TArgs>(args)...); }
+			T& EmplaceBack() DELEGATE_NOEXCEPT
+			{
+				Reserve(mSize + 1);
+				return (*this)[mSize++];
+			}
+
+			T& operator[] (size_t index) DELEGATE_NOEXCEPT 
+			{ 
+				WRENCH_ASSERT(index < mSize);
+				return mChunks[index / ChunkSize][index % ChunkSize]; 
+			}
 
-			TSubscriptionHandle operator+= (std::function<void(TArgs...)> listener) DELEGATE_NOEXCEPT { return Subscribe(listener); }
-			bool operator-= (TSubscriptionHandle handle) DELEGATE_NOEXCEPT { return Unsubscribe(handle); }
-		private:
-			std::vector<std::function<void(TArgs...)>> mListeners;
-			size_t mFirstFreeEntityIndex = 0;
+			const T& operator[] (size_t index) const DELEGATE_NOEXCEPT
+			{
+				WRENCH_ASSERT(index < mSize);
+				return mChunks[index / ChunkSize][index % ChunkSize];
+			}
 
-			DELEGATE_DECLARE_OBJECT_MUTEX;
+			/// \note Resets elements beyond the given size and releases chunks that became unused
+			void Truncate(size_t size) DELEGATE_NOEXCEPT
+			{
+				for (size_t i = size; i < mSize; ++i)
+				{
+					(*this)[i] = T();
+				}
+
+				mSize = (std::min)(size, mSize);
+				mChunks.resize((mSize + ChunkSize - 1) / ChunkSize);
+			}
+
+			size_t Size() const DELEGATE_NOEXCEPT { return mSize; }
+		private:
+			std::vector<std::unique_ptr<T[]>> mChunks;
+			size_t mSize;
 	};
 
+#if DELEGATE_LOCK_FREE_NOTIFY_ENABLED
+
+	/*!
+		class SnapshotPtr
+
+		\brief The class holds an immutable object that is replaced as a whole on each modification (RCU-like scheme).
 
-	template <>
-	class Delegate<> final
+		Readers never lock, they only register themselves within a counter. Replaced versions are retired and
+		recycled later when no reader is able to observe them. All non-const methods should be called under a writer's lock.
+	*/
+
+	template <typename T>
+	class SnapshotPtr final
 	{
 		public:
-			Delegate() DELEGATE_NOEXCEPT
-				: mFirstFreeEntityIndex((std::numeric_limits<size_t>::max)()) {}
-			~Delegate() DELEGATE_NOEXCEPT { UnsubscribeAll(); }
+			class TReadGuard final
+			{
+				public:
+					explicit TReadGuard(const SnapshotPtr<T>& owner) DELEGATE_NOEXCEPT :
+						mpOwner(&owner), mpSnapshot(owner._acquire())
+					{
+					}
+
+					TReadGuard(TReadGuard&& guard) DELEGATE_NOEXCEPT :
+						mpOwner(guard.mpOwner), mpSnapshot(guard.mpSnapshot)
+					{
+						guard.mpOwner = nullptr;
+					}
+
+					~TReadGuard() DELEGATE_NOEXCEPT
+					{
+						if (mpOwner)
+						{
+							mpOwner->_release();
+						}
+					}
+
+					const T* Get() const DELEGATE_NOEXCEPT { return mpSnapshot; }
+
+					TReadGuard(const TReadGuard&) = delete;
+					TReadGuard& operator= (const TReadGuard&) = delete;
+				private:
+					const SnapshotPtr<T>* mpOwner;
+					const T* mpSnapshot;
+			};
 
-			TSubscriptionHandle Subscribe(std::function<void()> listener) DELEGATE_NOEXCEPT
+		public:
+			SnapshotPtr() DELEGATE_NOEXCEPT : 
+				mpCurrSnapshot(nullptr), mReadersCount(0), mHasRetiredSnapshots(false), mVersion(0), mReleasedVersion(0)
 			{
-				DELEGATE_LOCK_THREAD;
+			}
 
-				if (!listener)
+			~SnapshotPtr() DELEGATE_NOEXCEPT
+			{
+				WRENCH_ASSERT(!mReadersCount.load());
+
+				delete mpCurrSnapshot.load();
+
+				_releaseRetired();
+
+				for (T* pCurrSnapshot : mFreeSnapshots)
 				{
-					return TSubscriptionHandle::Invalid;
+					delete pCurrSnapshot;
 				}
+			}
+
+			/// \note Wait-free if std::atomic of integers and pointers is lock-free on the target platform
+			TReadGuard Read() const DELEGATE_NOEXCEPT { return TReadGuard(*this); }
+
+			/// \note The method is safe to call only from a writer that holds its lock
+			const T* GetUnsafe() const DELEGATE_NOEXCEPT { return mpCurrSnapshot.load(); }
 
-	#if 0 /// \todo
-				auto it = std::find_if(mListeners.cbegin(), mListeners.cend(), [&listener](auto&& currEntity)
+			/// \note Returns a recycled object if there is any, its content is unspecified
+			T* Allocate() DELEGATE_NOEXCEPT
+			{
+				std::lock_guard<std::mutex> lock(mRetiredMutex);
+
+				if (mFreeSnapshots.empty())
 				{
-					return reinterpret_cast<uintptr_t>(currEntity.target()) == reinterpret_cast<uintptr_t>(listener.target());
-				});
-				if (it != mListeners.cend())
+					return new T();
+				}
+
+				T* pSnapshot = mFreeSnapshots.back();
+				mFreeSnapshots.pop_back();
+
+				return pSnapshot;
+			}
+
+			/// \note Fills the pool of recycled objects up to its limit and applies the action to each of them
+			template <typename TAction>
+			void ReserveRecycled(TAction&& action) DELEGATE_NOEXCEPT
+			{
+				std::lock_guard<std::mutex> lock(mRetiredMutex);
+
+				mFreeSnapshots.reserve(mMaxFreeSnapshotsCount);
+				mRetiredSnapshots.reserve(mMaxFreeSnapshotsCount);
+
+				while (mFreeSnapshots.size() < mMaxFreeSnapshotsCount)
 				{
-					return static_cast<TSubscriptionHandle>(std::distance(mListeners.cbegin(), it)); /// \note The listener's already been registered so return its handle
+					mFreeSnapshots.push_back(new T());
 				}
-	#endif
 
-				if (mFirstFreeEntityIndex < mListeners.size())
+				for (T* pCurrSnapshot : mFreeSnapshots)
 				{
-					mListeners[mFirstFreeEntityIndex] = std::move(listener);
-					auto result = static_cast<TSubscriptionHandle>(mFirstFreeEntityIndex);
+					action(*pCurrSnapshot);
+				}
+			}
+
+			/// \note Returns a version of the published snapshot
+			uint64_t Publish(T* pNewSnapshot) DELEGATE_NOEXCEPT
+			{
+				std::lock_guard<std::mutex> lock(mRetiredMutex);
 
-					mFirstFreeEntityIndex = mListeners.size();
+				T* pPrevSnapshot = mpCurrSnapshot.exchange(pNewSnapshot);
+				++mVersion;
 
-					return result;
+				if (pPrevSnapshot)
+				{
+					mRetiredSnapshots.push_back(pPrevSnapshot);
+					mHasRetiredSnapshots.store(true);
 				}
 
-				mListeners.emplace_back(listener);
+				_tryReclaimRetired();
 
-				return static_cast<TSubscriptionHandle>(mListeners.size() - 1);
+				return mVersion;
 			}
 
-			bool Unsubscribe(TSubscriptionHandle subscriptionHandle) DELEGATE_NOEXCEPT
+			/// \note Returns true if no reader could observe any snapshot that was published before the given version
+			bool IsReleased(uint64_t version) const DELEGATE_NOEXCEPT { return mReleasedVersion.load() >= version; }
+
+			SnapshotPtr(const SnapshotPtr&) = delete;
+			SnapshotPtr& operator= (const SnapshotPtr&) = delete;
+		private:
+			const T* _acquire() const DELEGATE_NOEXCEPT
 			{
-				DELEGATE_LOCK_THREAD;
+				mReadersCount.fetch_add(1);		/// \note The increment should be visible before the pointer is loaded, so seq_cst ordering is used
+				return mpCurrSnapshot.load();
+			}
 
-				size_t index = static_cast<size_t>(subscriptionHandle);
-				if (index >= mListeners.size())
+			void _release() const DELEGATE_NOEXCEPT
+			{
+				if (mReadersCount.fetch_sub(1) != 1 || !mHasRetiredSnapshots.load())
 				{
-					WRENCH_ASSERT(false);
-					return false;
+					return;
 				}
 
-				if (!mListeners[index])
+				/// \note The last reader cleans up retired snapshots but it never waits for a writer
+				std::unique_lock<std::mutex> lock(mRetiredMutex, std::try_to_lock);
+				if (lock.owns_lock())
 				{
-					return false;
+					_tryReclaimRetired();
 				}
-
-				mListeners[index] = nullptr;
-				mFirstFreeEntityIndex = static_cast<size_t>(subscriptionHandle);
-
-				return true;
 			}
 
-			void UnsubscribeAll() DELEGATE_NOEXCEPT
+			/// \note Any reader that could observe a retired snapshot has incremented the counter before it was replaced
+			void _tryReclaimRetired() const DELEGATE_NOEXCEPT
 			{
-				DELEGATE_LOCK_THREAD;
+				if (mReadersCount.load())
+				{
+					return;
+				}
 
-				mFirstFreeEntityIndex = (std::numeric_limits<size_t>::max)();
-				mListeners.clear();
+				_releaseRetired();
 			}
 
-			void Notify() DELEGATE_NOEXCEPT
+			void _releaseRetired() const DELEGATE_NOEXCEPT
 			{
-				DELEGATE_LOCK_THREAD;
-
-				for (auto&& currListener : mListeners)
+				for (T* pCurrSnapshot : mRetiredSnapshots)
 				{
-					if (currListener)
+					if (mFreeSnapshots.size() < mMaxFreeSnapshotsCount)
 					{
-						currListener();
+						mFreeSnapshots.push_back(pCurrSnapshot);
+						continue;
 					}
+
+					delete pCurrSnapshot;
 				}
-			}
 
-			void operator()() DELEGATE_NOEXCEPT { Notify(); }
+				mRetiredSnapshots.clear();
+				mHasRetiredSnapshots.store(false);
+
+				mReleasedVersion.store(mVersion);
+			}
 
-			TSubscriptionHandle operator+= (std::function<void()> listener) DELEGATE_NOEXCEPT { return Subscribe(listener); }
-			bool operator-= (TSubscriptionHandle handle) DELEGATE_NOEXCEPT { return Unsubscribe(handle); }
 		private:
-			std::vector<std::function<void()>> mListeners;
-			size_t mFirstFreeEntityIndex = 0;
+			static constexpr size_t mMaxFreeSnapshotsCount = 2;
 
-			DELEGATE_DECLARE_OBJECT_MUTEX;
+			std::atomic<T*> mpCurrSnapshot;
+
+			mutable std::atomic<uint32_t> mReadersCount;
+			mutable std::atomic<bool> mHasRetiredSnapshots;
+
+			mutable std::mutex mRetiredMutex;
+			mutable std::vector<T*> mRetiredSnapshots;
+			mutable std::vector<T*> mFreeSnapshots;
+
+			uint64_t mVersion;
+			mutable std::atomic<uint64_t> mReleasedVersion;
 	};
 
+#endif
+
+
+#if DELEGATE_ENABLE_THREAD_SAFENESS
+
+	/*!
+		class DelegateThreadPool
+
+		\brief A fixed set of worker threads that is used by Delegate::NotifyParallel.
+
+		ParallelFor runs a single job at a time, the calling thread takes part in it too. Nested calls which are
+		made from inside of a task are executed sequentially by the calling thread.
+	*/
+
+	class DelegateThreadPool final
+	{
+		public:
+			explicit DelegateThreadPool(uint32_t workersCount = _getDefaultWorkersCount()) DELEGATE_NOEXCEPT :
+				mpAction(nullptr), mpInvokeAction(nullptr), mTasksCount(0), mNextTaskIndex(0), mCompletedTasksCount(0), 
+				mActiveWorkersCount(0), mJobId(0), mIsRunning(true)
+			{
+				mWorkers.reserve(workersCount);
+
+				for (uint32_t i = 0; i < workersCount; ++i)
+				{
+					mWorkers.emplace_back([this] { _workerLoop(); });
+				}
+			}
+
+			~DelegateThreadPool() DELEGATE_NOEXCEPT
+			{
+				{
+					std::lock_guard<std::mutex> lock(mMutex);
+					mIsRunning = false;
+				}
+
+				mHasJobCondition.notify_all();
+
+				for (std::thread& currWorker : mWorkers)
+				{
+					currWorker.join();
+				}
+			}
+
+			/// \note Invokes action(taskIndex) for each index in [0, tasksCount) and returns when all of them are completed
+			template <typename TAction>
+			void ParallelFor(uint32_t tasksCount, TAction&& action) DELEGATE_NOEXCEPT
+			{
+				bool& isInsideTask = _isInsideTask();
+
+				if (mWorkers.empty() || tasksCount < 2 || isInsideTask)
+				{
+					for (uint32_t i = 0; i < tasksCount; ++i)
+					{
+						action(i);
+					}
+
+					return;
+				}
+
+				std::lock_guard<std::mutex> jobLock(mJobMutex);
+
+				{
+					std::lock_guard<std::mutex> lock(mMutex);
+
+					mpAction = &action;
+					mpInvokeAction = &_invokeAction<typename std::remove_reference<TAction>::type>;
+					mTasksCount = tasksCount;
+					mNextTaskIndex.store(0);
+					mCompletedTasksCount = 0;
+
+					++mJobId;
+				}
+
+				mHasJobCondition.notify_all();
+
+				_runTasks();
+
+				/// \note Workers don't touch the job after they have left it, so it's safe to return
+				std::unique_lock<std::mutex> lock(mMutex);
+				mJobCompletedCondition.wait(lock, [this] { return mCompletedTasksCount == mTasksCount && !mActiveWorkersCount; });
+
+				mpAction = nullptr;
+				mpInvokeAction = nullptr;
+			}
+
+			uint32_t GetWorkersCount() const DELEGATE_NOEXCEPT { return static_cast<uint32_t>(mWorkers.size()); }
+
+			DelegateThreadPool(const DelegateThreadPool&) = delete;
+			DelegateThreadPool& operator= (const DelegateThreadPool&) = delete;
+		private:
+			static uint32_t _getDefaultWorkersCount() DELEGATE_NOEXCEPT
+			{
+				const uint32_t hardwareThreadsCount = std::thread::hardware_concurrency();
+				return hardwareThreadsCount > 1 ? hardwareThreadsCount - 1 : 0; /// \note The calling thread is also a worker
+			}
+
+			static bool& _isInsideTask() DELEGATE_NOEXCEPT
+			{
+				static thread_local bool isInsideTask = false;
+				return isInsideTask;
+			}
+
+			template <typename TAction>
+			static void _invokeAction(void* pAction, uint32_t taskIndex)
+			{
+				(*static_cast<TAction*>(pAction))(taskIndex);
+			}
+
+			void _runTasks() DELEGATE_NOEXCEPT
+			{
+				bool& isInsideTask = _isInsideTask();
+				isInsideTask = true;
+
+				uint32_t completedTasksCount = 0;
+
+				for (uint32_t taskIndex = mNextTaskIndex.fetch_add(1); taskIndex < mTasksCount; taskIndex = mNextTaskIndex.fetch_add(1))
+				{
+					mpInvokeAction(mpAction, taskIndex);
+					++completedTasksCount;
+				}
+
+				isInsideTask = false;
+
+				if (!completedTasksCount)
+				{
+					return;
+				}
+
+				std::lock_guard<std::mutex> lock(mMutex);
+				mCompletedTasksCount += completedTasksCount;
+			}
+
+			void _workerLoop() DELEGATE_NOEXCEPT
+			{
+				uint64_t lastJobId = 0;
+
+				while (true)
+				{
+					{
+						std::unique_lock<std::mutex> lock(mMutex);
+						mHasJobCondition.wait(lock, [this, lastJobId] { return !mIsRunning || (mJobId != lastJobId && mpAction); });
+
+						if (!mIsRunning)
+						{
+							return;
+						}
+
+						lastJobId = mJobId;
+						++mActiveWorkersCount;
+					}
+
+					_runTasks();
+
+					{
+						std::lock_guard<std::mutex> lock(mMutex);
+						--mActiveWorkersCount;
+					}
+
+					mJobCompletedCondition.notify_one();
+				}
+			}
+
+		private:
+			std::vector<std::thread> mWorkers;
+
+			std::mutex mJobMutex;
+			std::mutex mMutex;
+			std::condition_variable mHasJobCondition;
+			std::condition_variable mJobCompletedCondition;
+
+			void* mpAction;
+			void (*mpInvokeAction)(void*, uint32_t);
+
+			uint32_t mTasksCount;
+			std::atomic<uint32_t> mNextTaskIndex;
+			uint32_t mCompletedTasksCount;
+			uint32_t mActiveWorkersCount;
+
+			uint64_t mJobId;
+			bool mIsRunning;
+	};
+
+#endif
+
+
+	/*!
+		class ScopedConnection
+
+		\brief The connection unsubscribes its listener when it's destroyed. The delegate should outlive it.
+	*/
+
+	class ScopedConnection final
+	{
+		public:
+			ScopedConnection() DELEGATE_NOEXCEPT = default;
+
+			template <typename TDelegate>
+			ScopedConnection(TDelegate& delegate, TSubscriptionHandle handle) DELEGATE_NOEXCEPT :
+				mpDelegate(&delegate), mpUnsubscribe(&_unsubscribe<TDelegate>), mHandle(handle)
+			{
+			}
+
+			ScopedConnection(ScopedConnection&& connection) DELEGATE_NOEXCEPT :
+				mpDelegate(connection.mpDelegate), mpUnsubscribe(connection.mpUnsubscribe), mHandle(connection.Release())
+			{
+			}
+
+			~ScopedConnection() DELEGATE_NOEXCEPT { Disconnect(); }
+
+			ScopedConnection& operator= (ScopedConnection&& connection) DELEGATE_NOEXCEPT
+			{
+				if (this != &connection)
+				{
+					Disconnect();
+
+					mpDelegate = connection.mpDelegate;
+					mpUnsubscribe = connection.mpUnsubscribe;
+					mHandle = connection.Release();
+				}
+
+				return *this;
+			}
+
+			void Disconnect() DELEGATE_NOEXCEPT
+			{
+				if (IsConnected())
+				{
+					mpUnsubscribe(mpDelegate, mHandle);
+					mHandle = TSubscriptionHandle::Invalid;
+				}
+			}
+
+			/// \note The listener stays subscribed, the returned handle should be used to unsubscribe it
+			TSubscriptionHandle Release() DELEGATE_NOEXCEPT
+			{
+				const TSubscriptionHandle handle = mHandle;
+				mHandle = TSubscriptionHandle::Invalid;
+
+				return handle;
+			}
+
+			TSubscriptionHandle GetHandle() const DELEGATE_NOEXCEPT { return mHandle; }
+			bool IsConnected() const DELEGATE_NOEXCEPT { return TSubscriptionHandle::Invalid != mHandle; }
+
+			ScopedConnection(const ScopedConnection&) = delete;
+			ScopedConnection& operator= (const ScopedConnection&) = delete;
+		private:
+			template <typename TDelegate>
+			static void _unsubscribe(void* pDelegate, TSubscriptionHandle handle) DELEGATE_NOEXCEPT { static_cast<TDelegate*>(pDelegate)->Unsubscribe(handle); }
+		private:
+			void* mpDelegate = nullptr;
+			void (*mpUnsubscribe)(void*, TSubscriptionHandle) = nullptr;
+
+			TSubscriptionHandle mHandle = TSubscriptionHandle::Invalid;
+	};
+
+
+	/*!
+		class Delegate
+
+		\brief The class is an observable event that dispatches given arguments to all its listeners.
+
+		Listeners are invoked in order of their priorities, the ones with higher priority go first. Listeners with 
+		equal priorities are invoked in order of their subscription. A cancellable listener returns true to stop 
+		propagation of an event to the rest ones.
+
+		Listeners are stored inline within chunks, so neither a subscription nor a notification allocates memory
+		after Reserve() was called. In the lock-free mode each subscription copies the array of active listeners into 
+		a recycled snapshot which takes O(n), a new snapshot is allocated only if running notifications still hold 
+		the recycled ones. Free slots are reused starting from the lowest index, trailing chunks that become 
+		unused are released. Each slot has a generation which is a part of a handle, so a stale handle never affects 
+		a listener that has reused its slot. Notify iterates over a dense array of live listeners only.
+		
+		Listeners are allowed to subscribe, unsubscribe or notify from within a notification. Such modifications take 
+		effect when the notification is completed, so listeners that were unsubscribed during it still could be invoked
+		by it. Their destruction is postponed until none of running notifications is able to reach them.
+
+		If DELEGATE_ENABLE_LOCK_FREE_NOTIFY is turned on the delegate publishes an immutable snapshot of pointers to 
+		listeners on each subscription. So Notify never takes a lock and it can be invoked concurrently. Otherwise 
+		modifications that are made during a notification are recorded and applied after the outermost one is completed.
+	*/
+
+	template <typename... TArgs>
+	class Delegate final
+	{
+		public:
+			using TListener = InlineFunction<bool(TArgs...)>;	///< Returns true if the event shouldn't be propagated further
+			using TEventTraits = TDelegateEventTraits<TArgs...>;
+			using TEvent = typename TEventTraits::TEvent;
+			using TEventsSpan = TSpan<TEvent>;
+#if DELEGATE_ENABLE_PROFILING
+			using TSlowListenerCallback = InlineFunction<void(TSubscriptionHandle, uint64_t)>;	///< Receives the listener's handle and the call's duration in cycles
+#endif
+		private:
+			struct TListenerEntity;
+
+			using TListenersArray = std::vector<TListenerEntity*>;
+
+		public:
+			Delegate() DELEGATE_NOEXCEPT = default;
+			~Delegate() DELEGATE_NOEXCEPT = default;
+
+			/// \note The listener is a callable with void(TArgs...) signature
+			template <typename TCallable>
+			TSubscriptionHandle Subscribe(TCallable&& listener, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				if (IsNullCallable(listener))
+				{
+					return TSubscriptionHandle::Invalid;
+				}
+
+				return _subscribe(TListenerAdapter<typename std::decay<TCallable>::type> { std::forward<TCallable>(listener) }, priority, nullptr);
+			}
+
+			/// \note The listener is a callable with bool(TArgs...) signature, it returns true to stop the event's propagation
+			template <typename TCallable>
+			TSubscriptionHandle SubscribeCancellable(TCallable&& listener, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				return _subscribe(TListener(std::forward<TCallable>(listener)), priority, nullptr);
+			}
+
+			/*!
+				\brief The listener receives all events of NotifyBatch at once as TSpan<TEvent>. A single notification
+				is passed to it as a span of one element.
+			*/
+
+			template <typename TCallable>
+			TSubscriptionHandle SubscribeBatch(TCallable&& listener, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				if (IsNullCallable(listener))
+				{
+					return TSubscriptionHandle::Invalid;
+				}
+
+				using TAdapter = TBatchListenerAdapter<typename std::decay<TCallable>::type>;
+
+				return _subscribe(TAdapter { std::forward<TCallable>(listener) }, priority, &_invokeBatchListener<TAdapter>);
+			}
+
+			/*!
+				\brief The listener is invoked while its owner is alive, the owner is locked for the time of a call. Listeners
+				of dead owners are skipped and removed by Notify() in batches, see DELEGATE_EXPIRED_LISTENERS_PRUNE_THRESHOLD.
+			*/
+
+			template <typename TOwner, typename TCallable>
+			TSubscriptionHandle SubscribeWeak(const std::weak_ptr<TOwner>& pOwner, TCallable&& listener, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				if (IsNullCallable(listener))
+				{
+					return TSubscriptionHandle::Invalid;
+				}
+
+				using TAdapter = TWeakListenerAdapter<TOwner, typename std::decay<TCallable>::type>;
+
+				return _subscribe(TAdapter { pOwner, std::forward<TCallable>(listener) }, priority, nullptr, &_isListenerExpired<TAdapter>);
+			}
+
+			template <typename TClass>
+			TSubscriptionHandle SubscribeWeak(const std::weak_ptr<TClass>& pOwner, void (TClass::*pMethod)(TArgs...), int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				using TAdapter = TWeakMethodAdapter<TClass, void (TClass::*)(TArgs...)>;
+
+				return _subscribe(TAdapter { pOwner, pMethod }, priority, nullptr, &_isListenerExpired<TAdapter>);
+			}
+
+			/// \note Accepts the same arguments as Subscribe, the listener is unsubscribed when the connection is destroyed
+			template <typename... TSubscribeArgs>
+			ScopedConnection SubscribeScoped(TSubscribeArgs&&... args) DELEGATE_NOEXCEPT
+			{
+				return ScopedConnection(*this, Subscribe(std::forward<TSubscribeArgs>(args)...));
+			}
+
+			/// \note The fast path for methods which avoids std::bind's overhead
+			template <typename TClass>
+			TSubscriptionHandle Subscribe(TClass* pObject, void (TClass::*pMethod)(TArgs...), int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				return Subscribe(TMemberFunctionBinding<TClass, void (TClass::*)(TArgs...)> { pObject, pMethod }, priority);
+			}
+
+			template <typename TClass>
+			TSubscriptionHandle Subscribe(const TClass* pObject, void (TClass::*pMethod)(TArgs...) const, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				return Subscribe(TMemberFunctionBinding<const TClass, void (TClass::*)(TArgs...) const> { pObject, pMethod }, priority);
+			}
+
+			/// \note The method is known at compile time so it's called directly, e.g. Subscribe<Foo, &Foo::Bar>(&foo)
+			template <typename TClass, void (TClass::*pMethod)(TArgs...)>
+			TSubscriptionHandle Subscribe(TClass* pObject, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				return Subscribe(TStaticMemberFunctionBinding<void (TClass::*)(TArgs...), pMethod, TClass> { pObject }, priority);
+			}
+
+			/// \note Returns false for stale handles, i.e. the ones which listeners have been already unsubscribed
+			bool Unsubscribe(TSubscriptionHandle subscriptionHandle) DELEGATE_NOEXCEPT
+			{
+				DELEGATE_LOCK_THREAD;
+
+				const uint32_t index = _getHandleIndex(subscriptionHandle);
+				if (index >= mEntities.Size())
+				{
+					return false;
+				}
+
+				TListenerEntity& entity = mEntities[index];
+				if (E_ENTITY_STATE::SUBSCRIBED != entity.mState || entity.mGeneration != _getHandleGeneration(subscriptionHandle))
+				{
+					return false;
+				}
+
+				TListenerEntity* pEntity = &entity;
+
+				_updateActiveListeners([pEntity](TListenersArray& listeners)
+				{
+					/// \note A deferred pruning of expired listeners could have removed the entity already
+					auto it = std::find(listeners.begin(), listeners.end(), pEntity);
+					if (it != listeners.end())
+					{
+						listeners.erase(it);
+					}
+				});
+
+				_releaseEntity(index);
+				_collectReleasedEntities();
+
+				return true;
+			}
+
+			void UnsubscribeAll() DELEGATE_NOEXCEPT
+			{
+				DELEGATE_LOCK_THREAD;
+
+				_updateActiveListeners([](TListenersArray& listeners)
+				{
+					listeners.clear();
+				});
+
+				for (uint32_t i = 0; i < static_cast<uint32_t>(mEntities.Size()); ++i)
+				{
+					if (E_ENTITY_STATE::SUBSCRIBED == mEntities[i].mState)
+					{
+						_releaseEntity(i);
+					}
+				}
+
+				_collectReleasedEntities();
+			}
+
+			/// \note Removes listeners whose owners are dead, returns their number. Notify() calls it automatically
+			size_t PruneExpiredListeners() DELEGATE_NOEXCEPT
+			{
+				DELEGATE_LOCK_THREAD;
+
+				mExpiredListenersHint = 0;
+
+				for (uint32_t i = 0; i < static_cast<uint32_t>(mEntities.Size()); ++i)
+				{
+					TListenerEntity& currEntity = mEntities[i];
+
+					if (E_ENTITY_STATE::SUBSCRIBED == currEntity.mState && currEntity.mpIsExpired && currEntity.mpIsExpired(currEntity.mListener))
+					{
+						/// \note Marks the entity to find it within the active listeners, _releaseEntity sets the actual state
+						currEntity.mState = E_ENTITY_STATE::PENDING_RELEASE;
+						mExpiredEntities.push_back(i);
+					}
+				}
+
+				const size_t expiredListenersCount = mExpiredEntities.size();
+				if (!expiredListenersCount)
+				{
+					return 0;
+				}
+
+				/// \note All expired listeners are removed at once, so the lock-free mode publishes a single snapshot for them
+				_updateActiveListeners([](TListenersArray& listeners)
+				{
+					listeners.erase(std::remove_if(listeners.begin(), listeners.end(), [](const TListenerEntity* pEntity)
+					{
+						return E_ENTITY_STATE::SUBSCRIBED != pEntity->mState;
+					}), listeners.end());
+				});
+
+				for (uint32_t currIndex : mExpiredEntities)
+				{
+					_releaseEntity(currIndex);
+				}
+
+				mExpiredEntities.clear();
+
+				_collectReleasedEntities();
+
+				return expiredListenersCount;
+			}
+
+			/// \note Preallocates memory for the given number of listeners
+			void Reserve(size_t listenersCount) DELEGATE_NOEXCEPT
+			{
+				DELEGATE_LOCK_THREAD;
+
+				mEntities.Reserve(listenersCount);
+				mFreeEntities.reserve(listenersCount);
+
+				mPendingReleaseEntities.reserve(listenersCount);
+
+#if DELEGATE_LOCK_FREE_NOTIFY_ENABLED
+				const auto reserveListeners = [listenersCount](TListenersArray& listeners) { listeners.reserve(listenersCount); };
+
+				/// \note The published snapshot is immutable, so it's replaced with a reserved copy and recycled afterwards
+				mActiveListeners.ReserveRecycled(reserveListeners);
+				_updateActiveListeners([](TListenersArray&) {});
+				mActiveListeners.ReserveRecycled(reserveListeners);
+#else
+				/// \note The array could be iterated by a running notification, so the reallocation is deferred until it's completed
+				_updateActiveListeners([listenersCount](TListenersArray& listeners) { listeners.reserve(listenersCount); });
+#endif
+			}
+
+			/// \note Returns true if some listener has stopped the event's propagation
+			bool Notify(TArgs&&... args) DELEGATE_NOEXCEPT
+			{
+				bool isCancelled = false;
+				uint32_t expiredListenersCount = 0;
+
+				_readActiveListeners([&](const TListenersArray& listeners)
+				{
+					for (const TListenerEntity* pCurrEntity : listeners)
+					{
+						if (pCurrEntity->mpIsExpired && pCurrEntity->mpIsExpired(pCurrEntity->mListener))
+						{
+							++expiredListenersCount;
+							continue;
+						}
+
+						if (_invokeListener(*pCurrEntity, args...))
+						{
+							isCancelled = true;
+							return;
+						}
+					}
+				});
+
+				if (expiredListenersCount && (mExpiredListenersHint += expiredListenersCount) >= DELEGATE_EXPIRED_LISTENERS_PRUNE_THRESHOLD)
+				{
+					PruneExpiredListeners();
+				}
+
+				return isCancelled;
+			}
+
+			/*!
+				\brief The method dispatches a sequence of events at once. Batch listeners receive the whole span within
+				a single call, other ones are invoked for each event. Cancellation isn't supported by batched notifications,
+				so results of cancellable listeners are ignored.
+			*/
+
+			void NotifyBatch(TEventsSpan events) DELEGATE_NOEXCEPT
+			{
+				if (events.IsEmpty())
+				{
+					return;
+				}
+
+				_readActiveListeners([events](const TListenersArray& listeners)
+				{
+					for (const TListenerEntity* pCurrEntity : listeners)
+					{
+						if (pCurrEntity->mpInvokeBatch)
+						{
+							pCurrEntity->mpInvokeBatch(pCurrEntity->mListener, events);
+							continue;
+						}
+
+						for (const TEvent& currEvent : events)
+						{
+							TEventTraits::Invoke(pCurrEntity->mListener, currEvent);
+						}
+					}
+				});
+			}
+
+#if DELEGATE_ENABLE_THREAD_SAFENESS
+			/*!
+				\brief The method splits listeners into contiguous ranges which are invoked by workers of the given pool,
+				it returns when all of them are completed. Listeners should be independent from each other, so neither
+				priorities nor cancellation are taken into account.
+
+				If DELEGATE_ENABLE_LOCK_FREE_NOTIFY is turned off listeners of a parallel notification are not allowed 
+				to modify the delegate.
+			*/
+
+			void NotifyParallel(DelegateThreadPool& threadPool, const TArgs&... args) DELEGATE_NOEXCEPT
+			{
+				_readActiveListeners([&](const TListenersArray& listeners)
+				{
+					const size_t listenersCount = listeners.size();
+					const uint32_t tasksCount = static_cast<uint32_t>((std::min)(listenersCount, static_cast<size_t>(threadPool.GetWorkersCount()) + 1));
+
+					threadPool.ParallelFor(tasksCount, [&](uint32_t taskIndex)
+					{
+						const size_t lastListenerIndex = listenersCount * (taskIndex + 1) / tasksCount;
+
+						for (size_t i = listenersCount * taskIndex / tasksCount; i < lastListenerIndex; ++i)
+						{
+							listeners[i]->mListener(args...);
+						}
+					});
+				});
+			}
+#endif
+
+#if DELEGATE_ENABLE_PROFILING
+			/// \note Returns statistics of Notify's calls of the listener, a stale handle gives zeroes
+			TDelegateListenerStats GetListenerStats(TSubscriptionHandle handle) const DELEGATE_NOEXCEPT
+			{
+				DELEGATE_LOCK_THREAD;
+
+				TDelegateListenerStats stats;
+
+				const uint32_t index = _getHandleIndex(handle);
+				if (index >= mEntities.Size() || mEntities[index].mState != E_ENTITY_STATE::SUBSCRIBED || mEntities[index].mProfile.mHandle != handle)
+				{
+					return stats;
+				}
+
+				const TListenerProfile& profile = mEntities[index].mProfile;
+
+				stats.mCallsCount = profile.mCallsCount.load(std::memory_order_relaxed);
+				stats.mTotalCycles = profile.mTotalCycles.load(std::memory_order_relaxed);
+				stats.mMaxCycles = profile.mMaxCycles.load(std::memory_order_relaxed);
+
+				return stats;
+			}
+
+			/// \note The callback is invoked right after a listener which took at least thresholdCycles, set it before notifications
+			void SetSlowListenerCallback(uint64_t thresholdCycles, TSlowListenerCallback callback) DELEGATE_NOEXCEPT
+			{
+				DELEGATE_LOCK_THREAD;
+
+				mSlowListenerThreshold = thresholdCycles;
+				mSlowListenerCallback = std::move(callback);
+			}
+#endif
+
+			bool operator()(TArgs&&... args) DELEGATE_NOEXCEPT { return Notify(std::forward<TArgs>(args)...); }
+
+			template <typename TCallable>
+			TSubscriptionHandle operator+= (TCallable&& listener) DELEGATE_NOEXCEPT { return Subscribe(std::forward<TCallable>(listener)); }
+			bool operator-= (TSubscriptionHandle handle) DELEGATE_NOEXCEPT { return Unsubscribe(handle); }
+
+			Delegate(const Delegate&) = delete;
+			Delegate& operator= (const Delegate&) = delete;
+		private:
+			enum class E_ENTITY_STATE : uint8_t
+			{
+				FREE,
+				SUBSCRIBED,
+				PENDING_RELEASE,
+			};
+
+			using TBatchInvokeFunction = void(*)(const TListener&, TEventsSpan);
+			using TExpirationCheckFunction = bool(*)(const TListener&);
+
+#if DELEGATE_ENABLE_PROFILING
+			/// \note Counters are updated by concurrent notifications, the handle is immutable while the listener is subscribed
+			struct TListenerProfile
+			{
+				TListenerProfile() DELEGATE_NOEXCEPT = default;
+
+				/// \note Slots are reset by assignments, so the counters are reset instead of being copied
+				TListenerProfile& operator= (TListenerProfile&&) DELEGATE_NOEXCEPT
+				{
+					Reset(TSubscriptionHandle::Invalid);
+					return *this;
+				}
+
+				void Reset(TSubscriptionHandle handle) DELEGATE_NOEXCEPT
+				{
+					mHandle = handle;
+
+					mCallsCount.store(0, std::memory_order_relaxed);
+					mTotalCycles.store(0, std::memory_order_relaxed);
+					mMaxCycles.store(0, std::memory_order_relaxed);
+				}
+
+				TSubscriptionHandle mHandle = TSubscriptionHandle::Invalid;
+
+				std::atomic<uint64_t> mCallsCount { 0 };
+				std::atomic<uint64_t> mTotalCycles { 0 };
+				std::atomic<uint64_t> mMaxCycles { 0 };
+			};
+#endif
+
+			struct TListenerEntity
+			{
+				TListener mListener;
+				TBatchInvokeFunction mpInvokeBatch = nullptr;	///< Is set for batch listeners only
+				TExpirationCheckFunction mpIsExpired = nullptr;	///< Is set for listeners with weak owners only
+				int32_t mPriority = 0;
+				uint32_t mGeneration = 0;
+				E_ENTITY_STATE mState = E_ENTITY_STATE::FREE;
+#if DELEGATE_LOCK_FREE_NOTIFY_ENABLED
+				uint64_t mReleaseVersion = 0;
+#endif
+#if DELEGATE_ENABLE_PROFILING
+				mutable TListenerProfile mProfile;
+#endif
+			};
+
+			/// \note Wraps a listener that never stops propagation, the call is inlined into TListener's invoker
+			template <typename TCallable>
+			struct TListenerAdapter
+			{
+				bool operator()(TArgs... args) const
+				{
+					mListener(std::forward<TArgs>(args)...);
+					return false;
+				}
+
+				mutable TCallable mListener;
+			};
+
+			template <typename TOwner, typename TCallable>
+			struct TWeakListenerAdapter
+			{
+				bool operator()(TArgs... args) const
+				{
+					if (const std::shared_ptr<TOwner> pOwner = mpOwner.lock())
+					{
+						mListener(std::forward<TArgs>(args)...);
+					}
+
+					return false;
+				}
+
+				std::weak_ptr<TOwner> mpOwner;
+				mutable TCallable mListener;
+			};
+
+			template <typename TClass, typename TMethod>
+			struct TWeakMethodAdapter
+			{
+				bool operator()(TArgs... args) const
+				{
+					if (const std::shared_ptr<TClass> pOwner = mpOwner.lock())
+					{
+						(pOwner.get()->*mpMethod)(std::forward<TArgs>(args)...);
+					}
+
+					return false;
+				}
+
+				std::weak_ptr<TClass> mpOwner;
+				TMethod mpMethod;
+			};
+
+			template <typename TAdapter>
+			static bool _isListenerExpired(const TListener& listener) DELEGATE_NOEXCEPT
+			{
+				return listener.template GetTarget<TAdapter>()->mpOwner.expired();
+			}
+
+			/// \note Wraps a batch listener to make it look like a regular one
+			template <typename TCallable>
+			struct TBatchListenerAdapter
+			{
+				bool operator()(TArgs... args) const
+				{
+					const TEvent event(std::forward<TArgs>(args)...);
+					mListener(TEventsSpan(&event, 1));
+
+					return false;
+				}
+
+				mutable TCallable mListener;
+			};
+
+			template <typename TAdapter>
+			static void _invokeBatchListener(const TListener& listener, TEventsSpan events)
+			{
+				listener.template GetTarget<TAdapter>()->mListener(events);
+			}
+
+			TSubscriptionHandle _subscribe(TListener&& listener, int32_t priority, TBatchInvokeFunction pInvokeBatch, TExpirationCheckFunction pIsExpired = nullptr) DELEGATE_NOEXCEPT
+			{
+				if (!listener)
+				{
+					return TSubscriptionHandle::Invalid;
+				}
+
+				DELEGATE_LOCK_THREAD;
+
+				_collectReleasedEntities();
+
+				const uint32_t index = _allocateEntity();
+
+				TListenerEntity& entity = mEntities[index];
+				entity.mListener = std::move(listener);
+				entity.mpInvokeBatch = pInvokeBatch;
+				entity.mpIsExpired = pIsExpired;
+				entity.mPriority = priority;
+				entity.mState = E_ENTITY_STATE::SUBSCRIBED;
+
+#if DELEGATE_ENABLE_PROFILING
+				entity.mProfile.Reset(_makeHandle(index, entity.mGeneration));
+#endif
+
+				TListenerEntity* pEntity = &entity;
+
+				_updateActiveListeners([pEntity](TListenersArray& listeners)
+				{
+					/// \note Listeners are sorted by priorities in descending order, the new one goes after all with the same priority
+					auto it = std::upper_bound(listeners.begin(), listeners.end(), pEntity->mPriority, [](int32_t priority, const TListenerEntity* pCurrEntity)
+					{
+						return priority > pCurrEntity->mPriority;
+					});
+
+					listeners.insert(it, pEntity);
+				});
+
+				return _makeHandle(index, entity.mGeneration);
+			}
+
+			template <typename... TCallArgs>
+			bool _invokeListener(const TListenerEntity& entity, TCallArgs&... args) DELEGATE_NOEXCEPT
+			{
+#if DELEGATE_ENABLE_PROFILING
+				const uint64_t startCycles = GetCpuCyclesCount();
+				const bool isCancelled = entity.mListener(args...);
+				const uint64_t elapsedCycles = GetCpuCyclesCount() - startCycles;
+
+				TListenerProfile& profile = entity.mProfile;
+
+				profile.mCallsCount.fetch_add(1, std::memory_order_relaxed);
+				profile.mTotalCycles.fetch_add(elapsedCycles, std::memory_order_relaxed);
+
+				uint64_t maxCycles = profile.mMaxCycles.load(std::memory_order_relaxed);
+				while (elapsedCycles > maxCycles && !profile.mMaxCycles.compare_exchange_weak(maxCycles, elapsedCycles, std::memory_order_relaxed))
+				{
+				}
+
+				if (mSlowListenerCallback && elapsedCycles >= mSlowListenerThreshold)
+				{
+					mSlowListenerCallback(profile.mHandle, elapsedCycles);
+				}
+
+				return isCancelled;
+#else
+				return entity.mListener(args...);
+#endif
+			}
+
+			static TSubscriptionHandle _makeHandle(uint32_t index, uint32_t generation) DELEGATE_NOEXCEPT
+			{
+				return static_cast<TSubscriptionHandle>((static_cast<uint64_t>(generation) << 32) | index);
+			}
+
+			static uint32_t _getHandleIndex(TSubscriptionHandle handle) DELEGATE_NOEXCEPT { return static_cast<uint32_t>(static_cast<uint64_t>(handle)); }
+			static uint32_t _getHandleGeneration(TSubscriptionHandle handle) DELEGATE_NOEXCEPT { return static_cast<uint32_t>(static_cast<uint64_t>(handle) >> 32); }
+
+			/// \note The free list is a min-heap, so listeners are packed at the beginning of the storage
+			uint32_t _allocateEntity() DELEGATE_NOEXCEPT
+			{
+				if (!mFreeEntities.empty())
+				{
+					std::pop_heap(mFreeEntities.begin(), mFreeEntities.end(), std::greater<uint32_t>());
+
+					const uint32_t index = mFreeEntities.back();
+					mFreeEntities.pop_back();
+
+					return index;
+				}
+
+				const uint32_t index = static_cast<uint32_t>(mEntities.Size());
+				WRENCH_ASSERT(index < (std::numeric_limits<uint32_t>::max)());
+
+				mEntities.EmplaceBack().mGeneration = mFirstGeneration;
+
+				return index;
+			}
+
+			void _freeEntity(uint32_t index) DELEGATE_NOEXCEPT
+			{
+				TListenerEntity& entity = mEntities[index];
+
+				entity.mListener = nullptr;
+				entity.mpInvokeBatch = nullptr;
+				entity.mState = E_ENTITY_STATE::FREE;
+
+				mFreeEntities.push_back(index);
+				std::push_heap(mFreeEntities.begin(), mFreeEntities.end(), std::greater<uint32_t>());
+			}
+
+			template <typename TAction>
+			void _readActiveListeners(TAction&& action) DELEGATE_NOEXCEPT
+			{
+#if DELEGATE_LOCK_FREE_NOTIFY_ENABLED
+				auto snapshotGuard = mActiveListeners.Read();
+				
+				if (const TListenersArray* pListeners = snapshotGuard.Get())
+				{
+					action(*pListeners);
+				}
+#else
+				DELEGATE_LOCK_THREAD;
+
+				++mDispatchDepth;
+				action(mActiveListeners);
+
+				if (!--mDispatchDepth)
+				{
+					_applyPendingOperations();
+				}
+#endif
+			}
+
+			template <typename TAction>
+			void _updateActiveListeners(TAction&& action) DELEGATE_NOEXCEPT
+			{
+#if DELEGATE_LOCK_FREE_NOTIFY_ENABLED
+				const TListenersArray* pCurrListeners = mActiveListeners.GetUnsafe();
+
+				TListenersArray* pNewListeners = mActiveListeners.Allocate();
+				
+				if (pCurrListeners)
+				{
+					pNewListeners->assign(pCurrListeners->cbegin(), pCurrListeners->cend());
+				}
+				else
+				{
+					pNewListeners->clear();
+				}
+
+				action(*pNewListeners);
+
+				mLastPublishedVersion = mActiveListeners.Publish(pNewListeners);
+#else
+				if (mDispatchDepth)
+				{
+					mPendingOperations.emplace_back(std::forward<TAction>(action)); /// \note The array is being iterated now
+					return;
+				}
+
+				action(mActiveListeners);
+#endif
+			}
+
+#if !DELEGATE_LOCK_FREE_NOTIFY_ENABLED
+			void _applyPendingOperations() DELEGATE_NOEXCEPT
+			{
+				for (TListenersOperation& currOperation : mPendingOperations)
+				{
+					currOperation(mActiveListeners);
+				}
+
+				mPendingOperations.clear();
+
+				_collectReleasedEntities();
+			}
+#endif
+
+			/// \note Should be invoked after the listener was excluded from active ones
+			void _releaseEntity(uint32_t index) DELEGATE_NOEXCEPT
+			{
+				TListenerEntity& entity = mEntities[index];
+
+				++entity.mGeneration; /// \note Invalidates all existing handles of the entity
+
+#if DELEGATE_LOCK_FREE_NOTIFY_ENABLED
+				entity.mReleaseVersion = mLastPublishedVersion;
+#else
+				if (!mDispatchDepth)
+				{
+					_freeEntity(index);
+					return;
+				}
+#endif
+
+				/// \note Running notifications still could invoke the listener, so it's destroyed when all of them are completed
+				entity.mState = E_ENTITY_STATE::PENDING_RELEASE;
+				mPendingReleaseEntities.push_back(index);
+			}
+
+			void _collectReleasedEntities() DELEGATE_NOEXCEPT
+			{
+#if DELEGATE_LOCK_FREE_NOTIFY_ENABLED
+				auto it = std::remove_if(mPendingReleaseEntities.begin(), mPendingReleaseEntities.end(), [this](uint32_t index)
+				{
+					if (!mActiveListeners.IsReleased(mEntities[index].mReleaseVersion))
+					{
+						return false;
+					}
+
+					_freeEntity(index);
+
+					return true;
+				});
+
+				mPendingReleaseEntities.erase(it, mPendingReleaseEntities.end());
+#else
+				if (mDispatchDepth)
+				{
+					return;
+				}
+
+				for (uint32_t currIndex : mPendingReleaseEntities)
+				{
+					_freeEntity(currIndex);
+				}
+
+				mPendingReleaseEntities.clear();
+#endif
+
+				if (mFreeEntities.size() > DELEGATE_LISTENERS_CHUNK_SIZE && mFreeEntities.size() * 2 > mEntities.Size())
+				{
+					_compactEntities();
+				}
+			}
+
+			/// \note Releases trailing free slots. Slots that will be created again start from a newer generation than any released one
+			void _compactEntities() DELEGATE_NOEXCEPT
+			{
+				size_t newSize = mEntities.Size();
+
+				while (newSize && E_ENTITY_STATE::FREE == mEntities[newSize - 1].mState)
+				{
+					mFirstGeneration = (std::max)(mFirstGeneration, mEntities[--newSize].mGeneration);
+				}
+
+				if (newSize == mEntities.Size())
+				{
+					return;
+				}
+
+				++mFirstGeneration;
+
+				mEntities.Truncate(newSize);
+
+				mFreeEntities.erase(std::remove_if(mFreeEntities.begin(), mFreeEntities.end(), [newSize](uint32_t index) { return index >= newSize; }), mFreeEntities.end());
+				std::make_heap(mFreeEntities.begin(), mFreeEntities.end(), std::greater<uint32_t>());
+			}
+
+		private:
+			ChunkedArray<TListenerEntity> mEntities;
+			std::vector<uint32_t> mFreeEntities;
+
+			uint32_t mFirstGeneration = 0;
+
+			std::vector<uint32_t> mPendingReleaseEntities;
+			std::vector<uint32_t> mExpiredEntities;
+
+#if DELEGATE_ENABLE_THREAD_SAFENESS
+			std::atomic<uint32_t> mExpiredListenersHint { 0 };	///< How many times Notify has met expired listeners since the last pruning
+#else
+			uint32_t mExpiredListenersHint = 0;
+#endif
+
+#if DELEGATE_LOCK_FREE_NOTIFY_ENABLED
+			SnapshotPtr<TListenersArray> mActiveListeners;
+
+			uint64_t mLastPublishedVersion = 0;
+#else
+			using TListenersOperation = InlineFunction<void(TListenersArray&), sizeof(void*)>;
+
+			TListenersArray mActiveListeners;
+
+			std::vector<TListenersOperation> mPendingOperations;
+			uint32_t mDispatchDepth = 0;
+#endif
+
+#if DELEGATE_ENABLE_PROFILING
+			TSlowListenerCallback mSlowListenerCallback;
+			uint64_t mSlowListenerThreshold = 0;
+#endif
+
+			DELEGATE_DECLARE_OBJECT_MUTEX;
+	};
+
+
+	/*!
+		\brief Combiners aggregate results of Delegate<TResult(TArgs...)>'s listeners while an event is dispatched.
+		operator() accepts a result of a single listener and returns true if the rest listeners shouldn't be invoked,
+		GetResult() returns the aggregated value.
+	*/
+
+	/// \note Writes results into a preallocated buffer, the dispatch stops when the buffer is full
+	template <typename T>
+	class CollectCombiner final
+	{
+		public:
+			CollectCombiner(T* pBuffer, size_t capacity) DELEGATE_NOEXCEPT : mpBuffer(pBuffer), mCapacity(capacity) {}
+
+			bool operator()(T&& value) DELEGATE_NOEXCEPT
+			{
+				WRENCH_ASSERT(mCount < mCapacity);
+				mpBuffer[mCount++] = std::move(value);
+
+				return mCount == mCapacity;
+			}
+
+			size_t GetResult() const DELEGATE_NOEXCEPT { return mCount; }
+		private:
+			T* mpBuffer;
+			size_t mCapacity;
+			size_t mCount = 0;
+	};
+
+	/// \note Keeps the first result which is true being converted into bool, e.g. a non-null pointer
+	template <typename T>
+	class FirstNonEmptyCombiner final
+	{
+		public:
+			bool operator()(T&& value) DELEGATE_NOEXCEPT
+			{
+				if (!static_cast<bool>(value))
+				{
+					return false;
+				}
+
+				mValue = std::move(value);
+
+				return true;
+			}
+
+			const T& GetResult() const DELEGATE_NOEXCEPT { return mValue; }
+		private:
+			T mValue {};
+	};
+
+	template <typename T>
+	class SumCombiner final
+	{
+		public:
+			explicit SumCombiner(T initialValue = T {}) DELEGATE_NOEXCEPT : mValue(std::move(initialValue)) {}
+
+			bool operator()(T&& value) DELEGATE_NOEXCEPT
+			{
+				mValue += value;
+				return false;
+			}
+
+			const T& GetResult() const DELEGATE_NOEXCEPT { return mValue; }
+		private:
+			T mValue;
+	};
+
+	/// \note TCompare(a, b) returns true if a should replace b, GetResult() returns the initial value if there were no listeners
+	template <typename T, typename TCompare>
+	class ExtremumCombiner final
+	{
+		public:
+			explicit ExtremumCombiner(T initialValue = T {}) DELEGATE_NOEXCEPT : mValue(std::move(initialValue)) {}
+
+			bool operator()(T&& value) DELEGATE_NOEXCEPT
+			{
+				if (!mHasValue || TCompare()(value, mValue))
+				{
+					mValue = std::move(value);
+					mHasValue = true;
+				}
+
+				return false;
+			}
+
+			const T& GetResult() const DELEGATE_NOEXCEPT { return mValue; }
+			bool HasValue() const DELEGATE_NOEXCEPT { return mHasValue; }
+		private:
+			T mValue;
+			bool mHasValue = false;
+	};
+
+	template <typename T> using MinCombiner = ExtremumCombiner<T, std::less<T>>;
+	template <typename T> using MaxCombiner = ExtremumCombiner<T, std::greater<T>>;
+
+	/// \note The dispatch stops on the first listener which returns false, no listeners means true
+	class AllTrueCombiner final
+	{
+		public:
+			bool operator()(bool value) DELEGATE_NOEXCEPT
+			{
+				mValue = value;
+				return !value;
+			}
+
+			bool GetResult() const DELEGATE_NOEXCEPT { return mValue; }
+		private:
+			bool mValue = true;
+	};
+
+
+	/*!
+		class Delegate<TResult(TArgs...)>
+
+		\brief The delegate's listeners return values which are aggregated by a combiner passed into Notify(), e.g.
+
+		Delegate<int(int)> delegate;
+		int results[8];
+		const size_t count = delegate.Notify(CollectCombiner<int>(results, 8), 42);
+
+		Results are passed to the combiner right after each listener returns, so no intermediate containers are
+		created. The delegate shares subscription, priorities and thread safety guarantees with Delegate<TArgs...>.
+	*/
+
+	template <typename TResult, typename... TArgs>
+	class Delegate<TResult(TArgs...)> final
+	{
+		static_assert(!std::is_void<TResult>::value, "[Delegate] Use Delegate<TArgs...> for listeners which return nothing");
+
+		private:
+			/// \note Type-erased reference to a combiner, it lives on the stack of Notify()
+			struct TResultSink
+			{
+				void* mpCombiner;
+				bool (*mpAccept)(void*, TResult&&);
+			};
+
+			using TDelegate = Delegate<TResultSink&, TArgs...>;
+		public:
+			using TListener = InlineFunction<TResult(TArgs...)>;
+
+		public:
+			Delegate() DELEGATE_NOEXCEPT = default;
+			~Delegate() DELEGATE_NOEXCEPT = default;
+
+			/// \note The listener is a callable with TResult(TArgs...) signature
+			template <typename TCallable>
+			TSubscriptionHandle Subscribe(TCallable&& listener, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				if (IsNullCallable(listener))
+				{
+					return TSubscriptionHandle::Invalid;
+				}
+
+				return mDelegate.SubscribeCancellable(TListenerAdapter<typename std::decay<TCallable>::type> { std::forward<TCallable>(listener) }, priority);
+			}
+
+			template <typename TClass>
+			TSubscriptionHandle Subscribe(TClass* pObject, TResult (TClass::*pMethod)(TArgs...), int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				return Subscribe(TMemberFunctionBinding<TClass, TResult (TClass::*)(TArgs...)> { pObject, pMethod }, priority);
+			}
+
+			template <typename TClass>
+			TSubscriptionHandle Subscribe(const TClass* pObject, TResult (TClass::*pMethod)(TArgs...) const, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				return Subscribe(TMemberFunctionBinding<const TClass, TResult (TClass::*)(TArgs...) const> { pObject, pMethod }, priority);
+			}
+
+			template <typename TClass, TResult (TClass::*pMethod)(TArgs...)>
+			TSubscriptionHandle Subscribe(TClass* pObject, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				return Subscribe(TStaticMemberFunctionBinding<TResult (TClass::*)(TArgs...), pMethod, TClass> { pObject }, priority);
+			}
+
+			bool Unsubscribe(TSubscriptionHandle handle) DELEGATE_NOEXCEPT { return mDelegate.Unsubscribe(handle); }
+			void UnsubscribeAll() DELEGATE_NOEXCEPT { mDelegate.UnsubscribeAll(); }
+
+			void Reserve(size_t listenersCount) DELEGATE_NOEXCEPT { mDelegate.Reserve(listenersCount); }
+
+#if DELEGATE_ENABLE_PROFILING
+			TDelegateListenerStats GetListenerStats(TSubscriptionHandle handle) const DELEGATE_NOEXCEPT { return mDelegate.GetListenerStats(handle); }
+
+			template <typename TCallback>
+			void SetSlowListenerCallback(uint64_t thresholdCycles, TCallback&& callback) DELEGATE_NOEXCEPT
+			{
+				mDelegate.SetSlowListenerCallback(thresholdCycles, std::forward<TCallback>(callback));
+			}
+#endif
+
+			/// \note Returns the combiner's result, the combiner may stop the dispatch before all listeners are invoked
+			template <typename TCombiner>
+			auto Notify(TCombiner&& combiner, TArgs... args) DELEGATE_NOEXCEPT -> typename std::decay<decltype(combiner.GetResult())>::type
+			{
+				TResultSink sink { std::addressof(combiner), &_accept<typename std::remove_reference<TCombiner>::type> };
+				mDelegate.Notify(sink, std::forward<TArgs>(args)...);
+
+				return combiner.GetResult();
+			}
+
+			/// \note Invokes all listeners and discards their results
+			void Notify(TArgs... args) DELEGATE_NOEXCEPT
+			{
+				TResultSink sink { nullptr, &_discard };
+				mDelegate.Notify(sink, std::forward<TArgs>(args)...);
+			}
+
+			template <typename TCallable>
+			TSubscriptionHandle operator+= (TCallable&& listener) DELEGATE_NOEXCEPT { return Subscribe(std::forward<TCallable>(listener)); }
+			bool operator-= (TSubscriptionHandle handle) DELEGATE_NOEXCEPT { return Unsubscribe(handle); }
+
+			Delegate(const Delegate&) = delete;
+			Delegate& operator= (const Delegate&) = delete;
+		private:
+			/// \note Passes the listener's result to the combiner, the result tells whether the dispatch should stop
+			template <typename TCallable>
+			struct TListenerAdapter
+			{
+				bool operator()(TResultSink& sink, TArgs... args) const
+				{
+					return sink.mpAccept(sink.mpCombiner, mListener(std::forward<TArgs>(args)...));
+				}
+
+				mutable TCallable mListener;
+			};
+
+			template <typename TCombiner>
+			static bool _accept(void* pCombiner, TResult&& value) { return (*static_cast<TCombiner*>(pCombiner))(std::forward<TResult>(value)); }
+
+			static bool _discard(void*, TResult&&) { return false; }
+		private:
+			TDelegate mDelegate;
+	};
+
+
+	/*!
+		class StaticDelegate
+
+		\brief The delegate's listeners are fixed at compile time, so Notify() calls each of them directly and
+		there is nothing to dispatch through at runtime. The listeners are invoked in order of their declaration,
+		one that returns true stops the event's propagation like a cancellable listener of Delegate.
+
+		\code
+			StaticDelegate<TStaticFunctionBinding<void(int), &Foo>, TStaticFunctionBinding<void(int), &Bar>> delegate;
+			delegate.Notify(42);
+
+			auto pipeline = MakeStaticDelegate([](int value) { ... }, [&state](int value) { ... });
+			pipeline(42);
+		\endcode
+	*/
+
+	template <typename... TListeners>
+	class StaticDelegate final
+	{
+		public:
+			StaticDelegate() = default;
+
+			template <typename... TArgs, typename = typename std::enable_if<(sizeof...(TArgs) > 0) && sizeof...(TArgs) == sizeof...(TListeners)>::type>
+			explicit StaticDelegate(TArgs&&... listeners) DELEGATE_NOEXCEPT : mListeners(std::forward<TArgs>(listeners)...) {}
+
+			/// \note Returns true if some listener has stopped the event's propagation
+			template <typename... TArgs>
+			bool Notify(TArgs&&... args) const DELEGATE_NOEXCEPT
+			{
+				return _notify(std::index_sequence_for<TListeners...>(), args...);
+			}
+
+			template <typename... TArgs>
+			bool operator()(TArgs&&... args) const DELEGATE_NOEXCEPT { return Notify(std::forward<TArgs>(args)...); }
+
+			template <size_t Index>
+			const typename std::tuple_element<Index, std::tuple<TListeners...>>::type& GetListener() const DELEGATE_NOEXCEPT { return std::get<Index>(mListeners); }
+
+			static constexpr size_t GetListenersCount() DELEGATE_NOEXCEPT { return sizeof...(TListeners); }
+		private:
+			template <size_t... Indices, typename... TArgs>
+			bool _notify(std::index_sequence<Indices...>, TArgs&... args) const DELEGATE_NOEXCEPT
+			{
+				bool isCancelled = false;
+
+				/// \note The initializer list guarantees the order of invocations, || skips the rest ones after a cancellation
+				const bool results[] = { false, (isCancelled = isCancelled || _invoke(std::get<Indices>(mListeners), args...))... };
+				(void)results;
+
+				return isCancelled;
+			}
+
+			template <typename TListener, typename... TArgs>
+			static auto _invoke(TListener& listener, TArgs&... args) -> typename std::enable_if<std::is_void<decltype(listener(args...))>::value, bool>::type
+			{
+				listener(args...);
+				return false;
+			}
+
+			template <typename TListener, typename... TArgs>
+			static auto _invoke(TListener& listener, TArgs&... args) -> typename std::enable_if<!std::is_void<decltype(listener(args...))>::value, bool>::type
+			{
+				return static_cast<bool>(listener(args...));
+			}
+		private:
+			mutable std::tuple<TListeners...> mListeners;
+	};
+
+
+	template <typename... TListeners>
+	StaticDelegate<typename std::decay<TListeners>::type...> MakeStaticDelegate(TListeners&&... listeners) DELEGATE_NOEXCEPT
+	{
+		return StaticDelegate<typename std::decay<TListeners>::type...>(std::forward<TListeners>(listeners)...);
+	}
+
+
+	/*!
+		class RingBuffer
+
+		\brief A bounded FIFO queue which preallocates memory for all its elements at once
+	*/
+
+	template <typename T>
+	class RingBuffer final
+	{
+		public:
+			explicit RingBuffer(size_t capacity) DELEGATE_NOEXCEPT :
+				mpElements(new TStorageType[capacity]), mCapacity(capacity), mHead(0), mSize(0)
+			{
+				WRENCH_ASSERT(capacity);
+			}
+
+			~RingBuffer() DELEGATE_NOEXCEPT
+			{
+				Clear();
+			}
+
+			/// \note The buffer should have a free space for the element
+			void Push(T&& value) DELEGATE_NOEXCEPT
+			{
+				WRENCH_ASSERT(!IsFull());
+
+				new (&mpElements[(mHead + mSize) % mCapacity]) T(std::move(value));
+				++mSize;
+			}
+
+			/// \note The buffer shouldn't be empty
+			T Pop() DELEGATE_NOEXCEPT
+			{
+				WRENCH_ASSERT(!IsEmpty());
+
+				T& element = *reinterpret_cast<T*>(&mpElements[mHead]);
+				T value(std::move(element));
+				element.~T();
+
+				mHead = (mHead + 1) % mCapacity;
+				--mSize;
+
+				return value;
+			}
+
+			void Clear() DELEGATE_NOEXCEPT
+			{
+				while (!IsEmpty())
+				{
+					Pop();
+				}
+			}
+
+			size_t GetSize() const DELEGATE_NOEXCEPT { return mSize; }
+			size_t GetCapacity() const DELEGATE_NOEXCEPT { return mCapacity; }
+
+			bool IsEmpty() const DELEGATE_NOEXCEPT { return !mSize; }
+			bool IsFull() const DELEGATE_NOEXCEPT { return mSize == mCapacity; }
+
+			RingBuffer(const RingBuffer&) = delete;
+			RingBuffer& operator= (const RingBuffer&) = delete;
+		private:
+			using TStorageType = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+			std::unique_ptr<TStorageType[]> mpElements;
+
+			size_t mCapacity;
+			size_t mHead;
+			size_t mSize;
+	};
+
+
+#if DELEGATE_ENABLE_THREAD_SAFENESS
+
+	/*!
+		\brief The enumeration describes what QueuedDelegate::Post does when the queue is full
+	*/
+
+	enum class E_QUEUE_OVERFLOW_POLICY : uint8_t
+	{
+		DROP,			///< The new event is discarded
+		BLOCK,			///< The producer waits until a consumer frees some space
+		OVERWRITE,		///< The oldest event is discarded in favour of the new one
+	};
+
+
+	/*!
+		class QueuedDelegate
+
+		\brief The delegate postpones notifications. Post() moves arguments into a bounded queue, while Dispatch()
+		drains it and invokes listeners. Dispatch() is called either explicitly or by a consumer thread.
+
+		Listeners are invoked without holding the queue's lock, so producers aren't blocked by them. Don't use
+		E_QUEUE_OVERFLOW_POLICY::BLOCK if the same thread both posts and dispatches events.
+	*/
+
+	template <typename... TArgs>
+	class QueuedDelegate final
+	{
+		public:
+			using TEvent = std::tuple<typename std::decay<TArgs>::type...>;
+			using TDelegate = Delegate<TArgs...>;
+
+		public:
+			explicit QueuedDelegate(size_t capacity, E_QUEUE_OVERFLOW_POLICY overflowPolicy = E_QUEUE_OVERFLOW_POLICY::DROP) DELEGATE_NOEXCEPT :
+				mQueue(capacity), mOverflowPolicy(overflowPolicy), mIsDispatchThreadRunning(false)
+			{
+				mDispatchBatch.reserve((std::min)(capacity, static_cast<size_t>(DELEGATE_QUEUE_DISPATCH_BATCH_SIZE)));
+			}
+
+			~QueuedDelegate() DELEGATE_NOEXCEPT
+			{
+				StopDispatchThread();
+			}
+
+			template <typename... TSubscribeArgs>
+			TSubscriptionHandle Subscribe(TSubscribeArgs&&... args) DELEGATE_NOEXCEPT { return mDelegate.Subscribe(std::forward<TSubscribeArgs>(args)...); }
+
+			bool Unsubscribe(TSubscriptionHandle subscriptionHandle) DELEGATE_NOEXCEPT { return mDelegate.Unsubscribe(subscriptionHandle); }
+			void UnsubscribeAll() DELEGATE_NOEXCEPT { mDelegate.UnsubscribeAll(); }
+
+			/// \note Returns false if the event was discarded because of E_QUEUE_OVERFLOW_POLICY::DROP
+			bool Post(TArgs... args) DELEGATE_NOEXCEPT
+			{
+				std::unique_lock<std::mutex> lock(mQueueMutex);
+
+				if (mQueue.IsFull())
+				{
+					switch (mOverflowPolicy)
+					{
+						case E_QUEUE_OVERFLOW_POLICY::DROP:
+							return false;
+						case E_QUEUE_OVERFLOW_POLICY::BLOCK:
+							mHasFreeSpaceCondition.wait(lock, [this] { return !mQueue.IsFull(); });
+							break;
+						case E_QUEUE_OVERFLOW_POLICY::OVERWRITE:
+							mQueue.Pop();
+							break;
+					}
+				}
+
+				mQueue.Push(TEvent(std::forward<TArgs>(args)...));
+
+				lock.unlock();
+				mHasEventsCondition.notify_one();
+
+				return true;
+			}
+
+			/// \note Returns the number of dispatched events. Should be called from a single consumer at a time
+			size_t Dispatch(size_t maxEventsCount = (std::numeric_limits<size_t>::max)()) DELEGATE_NOEXCEPT
+			{
+				size_t dispatchedEventsCount = 0;
+
+				while (dispatchedEventsCount < maxEventsCount)
+				{
+					{
+						std::lock_guard<std::mutex> lock(mQueueMutex);
+
+						const size_t batchSize = (std::min)({ mQueue.GetSize(), maxEventsCount - dispatchedEventsCount, mDispatchBatch.capacity() });
+
+						for (size_t i = 0; i < batchSize; ++i)
+						{
+							mDispatchBatch.emplace_back(mQueue.Pop());
+						}
+					}
+
+					if (mDispatchBatch.empty())
+					{
+						break;
+					}
+
+					mHasFreeSpaceCondition.notify_all();
+
+					for (TEvent& currEvent : mDispatchBatch)
+					{
+						_notify(currEvent, std::index_sequence_for<TArgs...>());
+					}
+
+					dispatchedEventsCount += mDispatchBatch.size();
+					mDispatchBatch.clear();
+				}
+
+				return dispatchedEventsCount;
+			}
+
+			/// \note Runs a thread that dispatches events as soon as they arrive
+			void StartDispatchThread() DELEGATE_NOEXCEPT
+			{
+				std::lock_guard<std::mutex> lock(mQueueMutex);
+
+				if (mIsDispatchThreadRunning)
+				{
+					return;
+				}
+
+				mIsDispatchThreadRunning = true;
+				mDispatchThread = std::thread([this] { _dispatchThreadLoop(); });
+			}
+
+			/// \note Events that were posted before the call are dispatched before the thread stops
+			void StopDispatchThread() DELEGATE_NOEXCEPT
+			{
+				{
+					std::lock_guard<std::mutex> lock(mQueueMutex);
+					mIsDispatchThreadRunning = false;
+				}
+
+				mHasEventsCondition.notify_all();
+
+				if (mDispatchThread.joinable())
+				{
+					mDispatchThread.join();
+				}
+			}
+
+			size_t GetPendingEventsCount() const DELEGATE_NOEXCEPT
+			{
+				std::lock_guard<std::mutex> lock(mQueueMutex);
+				return mQueue.GetSize();
+			}
+
+			QueuedDelegate(const QueuedDelegate&) = delete;
+			QueuedDelegate& operator= (const QueuedDelegate&) = delete;
+		private:
+			template <size_t... Indices>
+			void _notify(TEvent& event, std::index_sequence<Indices...>) DELEGATE_NOEXCEPT
+			{
+				mDelegate.Notify(std::move(std::get<Indices>(event))...);
+			}
+
+			void _dispatchThreadLoop() DELEGATE_NOEXCEPT
+			{
+				while (true)
+				{
+					{
+						std::unique_lock<std::mutex> lock(mQueueMutex);
+						mHasEventsCondition.wait(lock, [this] { return !mIsDispatchThreadRunning || !mQueue.IsEmpty(); });
+
+						if (!mIsDispatchThreadRunning && mQueue.IsEmpty())
+						{
+							return;
+						}
+					}
+
+					Dispatch();
+				}
+			}
+
+		private:
+			TDelegate mDelegate;
+
+			RingBuffer<TEvent> mQueue;
+			std::vector<TEvent> mDispatchBatch;
+
+			E_QUEUE_OVERFLOW_POLICY mOverflowPolicy;
+
+			mutable std::mutex mQueueMutex;
+			std::condition_variable mHasEventsCondition;
+			std::condition_variable mHasFreeSpaceCondition;
+
+			std::thread mDispatchThread;
+			bool mIsDispatchThreadRunning;
+	};
+
+
+#endif
+
+
+	/*!
+		class CoalescingDelegate
+
+		\brief The delegate collapses events with the same key which are posted within a window into a single one.
+		The window starts with the first post of a key, so an event is delayed at most by the window's duration.
+
+		By default the last posted value wins, a custom merge function combines a pending event with a new one
+		instead. Dispatch() invokes listeners without holding the lock and should be called from a single consumer
+		at a time. The lock is taken only if DELEGATE_ENABLE_THREAD_SAFENESS is on.
+	*/
+
+	template <typename TKey, typename... TArgs>
+	class CoalescingDelegate final
+	{
+		public:
+			using TEvent = std::tuple<typename std::decay<TArgs>::type...>;
+			using TDelegate = Delegate<TArgs...>;
+			using TClock = std::chrono::steady_clock;
+			using TMergeFunction = InlineFunction<void(TEvent&, TEvent&&)>;	///< Merges the second event into the first one
+
+		public:
+			explicit CoalescingDelegate(TClock::duration window, TMergeFunction mergeFunction = nullptr) DELEGATE_NOEXCEPT :
+				mWindow(window), mMergeFunction(std::move(mergeFunction))
+			{
+			}
+
+			~CoalescingDelegate() DELEGATE_NOEXCEPT = default;
+
+			template <typename... TSubscribeArgs>
+			TSubscriptionHandle Subscribe(TSubscribeArgs&&... args) DELEGATE_NOEXCEPT { return mDelegate.Subscribe(std::forward<TSubscribeArgs>(args)...); }
+
+			bool Unsubscribe(TSubscriptionHandle subscriptionHandle) DELEGATE_NOEXCEPT { return mDelegate.Unsubscribe(subscriptionHandle); }
+			void UnsubscribeAll() DELEGATE_NOEXCEPT { mDelegate.UnsubscribeAll(); }
+
+			/// \note Returns false if the event was merged into a pending one with the same key
+			bool Post(const TKey& key, TArgs... args) DELEGATE_NOEXCEPT
+			{
+				DELEGATE_LOCK_THREAD;
+
+				auto it = mPendingEventsIndices.find(key);
+				if (it != mPendingEventsIndices.end())
+				{
+					TEvent& pendingEvent = mPendingEvents[static_cast<size_t>(it->second - mFirstPendingEventIndex)].mEvent;
+
+					if (mMergeFunction)
+					{
+						mMergeFunction(pendingEvent, TEvent(std::forward<TArgs>(args)...));
+					}
+					else
+					{
+						pendingEvent = TEvent(std::forward<TArgs>(args)...);
+					}
+
+					++mCoalescedEventsCount;
+
+					return false;
+				}
+
+				mPendingEventsIndices.emplace(key, mFirstPendingEventIndex + mPendingEvents.size());
+				mPendingEvents.push_back({ key, TEvent(std::forward<TArgs>(args)...), TClock::now() + mWindow });
+
+				return true;
+			}
+
+			/// \note Dispatches events whose windows are over by the given moment, returns their number
+			size_t Dispatch(TClock::time_point currTime = TClock::now()) DELEGATE_NOEXCEPT
+			{
+				{
+					DELEGATE_LOCK_THREAD;
+
+					/// \note The window's duration is the same for all events, so they become ready in order of their posting
+					size_t readyEventsCount = 0;
+
+					for (; readyEventsCount < mPendingEvents.size(); ++readyEventsCount)
+					{
+						TPendingEvent& currPendingEvent = mPendingEvents[readyEventsCount];
+
+						if (currPendingEvent.mDeadline > currTime)
+						{
+							break;
+						}
+
+						mDispatchBatch.emplace_back(std::move(currPendingEvent.mEvent));
+						mPendingEventsIndices.erase(currPendingEvent.mKey);
+					}
+
+					mPendingEvents.erase(mPendingEvents.begin(), mPendingEvents.begin() + readyEventsCount);
+					mFirstPendingEventIndex += readyEventsCount;
+				}
+
+				for (TEvent& currEvent : mDispatchBatch)
+				{
+					_notify(currEvent, std::index_sequence_for<TArgs...>());
+				}
+
+				const size_t dispatchedEventsCount = mDispatchBatch.size();
+				mDispatchBatch.clear();
+
+				return dispatchedEventsCount;
+			}
+
+			/// \note Dispatches all pending events regardless of their windows
+			size_t Flush() DELEGATE_NOEXCEPT { return Dispatch((TClock::time_point::max)()); }
+
+			size_t GetPendingEventsCount() const DELEGATE_NOEXCEPT
+			{
+				DELEGATE_LOCK_THREAD;
+				return mPendingEvents.size();
+			}
+
+			/// \note The number of posts that were merged into pending events and haven't caused separate dispatches
+			uint64_t GetCoalescedEventsCount() const DELEGATE_NOEXCEPT
+			{
+				DELEGATE_LOCK_THREAD;
+				return mCoalescedEventsCount;
+			}
+
+			CoalescingDelegate(const CoalescingDelegate&) = delete;
+			CoalescingDelegate& operator= (const CoalescingDelegate&) = delete;
+		private:
+			struct TPendingEvent
+			{
+				TKey mKey;
+				TEvent mEvent;
+				TClock::time_point mDeadline;
+			};
+		private:
+			template <size_t... Indices>
+			void _notify(TEvent& event, std::index_sequence<Indices...>) DELEGATE_NOEXCEPT
+			{
+				mDelegate.Notify(std::move(std::get<Indices>(event))...);
+			}
+
+		private:
+			TDelegate mDelegate;
+
+			TClock::duration mWindow;
+			TMergeFunction mMergeFunction;
+
+			std::vector<TPendingEvent> mPendingEvents;	///< Sorted by deadlines
+			std::unordered_map<TKey, uint64_t> mPendingEventsIndices;	///< Indices are counted from the first ever posted event
+			uint64_t mFirstPendingEventIndex = 0;
+
+			std::vector<TEvent> mDispatchBatch;
+
+			uint64_t mCoalescedEventsCount = 0;
+
+			DELEGATE_DECLARE_OBJECT_MUTEX;
+	};
+
+
+	/*!
+		class TokenBucket
+
+		\brief The bucket is refilled with the given rate up to its capacity, an action is allowed while it has tokens
+	*/
+
+	class TokenBucket final
+	{
+		public:
+			using TClock = std::chrono::steady_clock;
+
+		public:
+			TokenBucket(double tokensPerSecond, double capacity, TClock::time_point startTime = TClock::now()) DELEGATE_NOEXCEPT :
+				mTokensPerSecond(tokensPerSecond), mCapacity(capacity), mTokensCount(capacity), mLastRefillTime(startTime)
+			{
+			}
+
+			bool TryConsume(TClock::time_point currTime = TClock::now(), double tokensCount = 1.0) DELEGATE_NOEXCEPT
+			{
+				if (currTime > mLastRefillTime)
+				{
+					const double elapsedSeconds = std::chrono::duration<double>(currTime - mLastRefillTime).count();
+
+					mTokensCount = (std::min)(mCapacity, mTokensCount + elapsedSeconds * mTokensPerSecond);
+					mLastRefillTime = currTime;
+				}
+
+				if (mTokensCount < tokensCount)
+				{
+					return false;
+				}
+
+				mTokensCount -= tokensCount;
+
+				return true;
+			}
+
+			double GetTokensCount() const DELEGATE_NOEXCEPT { return mTokensCount; }
+		private:
+			double mTokensPerSecond;
+			double mCapacity;
+			double mTokensCount;
+
+			TClock::time_point mLastRefillTime;
+	};
+
+
+	/*!
+		class RateLimitedDelegate
+
+		\brief The delegate passes at most a burst of events at once and then tokensPerSecond events per second,
+		the rest ones are dropped. Combine it with CoalescingDelegate if the latest state shouldn't be lost.
+	*/
+
+	template <typename... TArgs>
+	class RateLimitedDelegate final
+	{
+		public:
+			using TDelegate = Delegate<TArgs...>;
+			using TClock = TokenBucket::TClock;
+
+		public:
+			RateLimitedDelegate(double tokensPerSecond, double burstSize) DELEGATE_NOEXCEPT :
+				mTokenBucket(tokensPerSecond, burstSize)
+			{
+			}
+
+			~RateLimitedDelegate() DELEGATE_NOEXCEPT = default;
+
+			template <typename... TSubscribeArgs>
+			TSubscriptionHandle Subscribe(TSubscribeArgs&&... args) DELEGATE_NOEXCEPT { return mDelegate.Subscribe(std::forward<TSubscribeArgs>(args)...); }
+
+			bool Unsubscribe(TSubscriptionHandle subscriptionHandle) DELEGATE_NOEXCEPT { return mDelegate.Unsubscribe(subscriptionHandle); }
+			void UnsubscribeAll() DELEGATE_NOEXCEPT { mDelegate.UnsubscribeAll(); }
+
+			/// \note Returns false if the event was dropped because of the rate limit
+			bool Notify(TArgs... args) DELEGATE_NOEXCEPT
+			{
+				{
+					DELEGATE_LOCK_THREAD;
+
+					if (!mTokenBucket.TryConsume(TClock::now()))
+					{
+						++mDroppedEventsCount;
+						return false;
+					}
+				}
+
+				mDelegate.Notify(std::forward<TArgs>(args)...);
+
+				return true;
+			}
+
+			uint64_t GetDroppedEventsCount() const DELEGATE_NOEXCEPT
+			{
+				DELEGATE_LOCK_THREAD;
+				return mDroppedEventsCount;
+			}
+
+			RateLimitedDelegate(const RateLimitedDelegate&) = delete;
+			RateLimitedDelegate& operator= (const RateLimitedDelegate&) = delete;
+		private:
+			TDelegate mDelegate;
+
+			TokenBucket mTokenBucket;
+			uint64_t mDroppedEventsCount = 0;
+
+			DELEGATE_DECLARE_OBJECT_MUTEX;
+	};
 }
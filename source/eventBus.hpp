@@ -0,0 +1,354 @@
+/*!
+	\file eventBus.hpp
+	\date 17.10.2026
+	\author Ildar Kasimov
+
+	The library implements a typed event bus on top of delegate.hpp. Each event type has its own channel which is
+	found at compile time, so neither strings nor RTTI are involved into a dispatch.
+
+	Events are either dispatched immediately with Notify() or posted with Publish() into a queue of the calling
+	thread. The queues of all threads are merged and dispatched by Tick() which is usually called once per frame.
+
+	The usage of the library is pretty simple, just copy this file along with delegate.hpp into your enviornment
+	and include it
+
+	\code
+		#include "eventBus.hpp"
+
+		struct TWindowResizedEvent { uint32_t mWidth, mHeight; };
+		struct TKeyPressedEvent { uint32_t mKeyCode; };
+
+		Wrench::EventBus<TWindowResizedEvent, TKeyPressedEvent> eventBus;
+
+		eventBus.Subscribe<TKeyPressedEvent>([](const TKeyPressedEvent& event) { ... });
+		eventBus.Publish(TKeyPressedEvent { 42 });
+		eventBus.Tick();
+	\endcode
+
+*/
+
+#pragma once
+
+
+#include "delegate.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+
+namespace Wrench
+{
+	/// \note The index of T within TTypes, a type which isn't listed causes a compilation error
+	template <typename T, typename... TTypes> struct TTypeIndex;
+
+	template <typename T, typename... TTypes>
+	struct TTypeIndex<T, T, TTypes...> : std::integral_constant<size_t, 0> {};
+
+	template <typename T, typename TFirst, typename... TTypes>
+	struct TTypeIndex<T, TFirst, TTypes...> : std::integral_constant<size_t, 1 + TTypeIndex<T, TTypes...>::value> {};
+
+
+	struct TEventBusStats
+	{
+		uint64_t mPublishedCount = 0;	///< Events that were passed into Notify() or Publish()
+		uint64_t mDispatchedCount = 0;	///< Events that were delivered to listeners
+	};
+
+
+	/*!
+		class EventBus
+
+		\brief The bus owns a channel per each type of TEvents. A channel is Delegate<const TEvent&>, so it supports
+		priorities, cancellation and batch listeners.
+
+		Publish() only locks the queue of the calling thread which is never contended except the moment Tick() takes
+		events from it. Each thread remembers its queues of a few last buses of the same type, a thread that publishes
+		into more buses in turn looks its queue up under the bus's lock. Tick() takes events of all types out of the queues first and then dispatches them type by type,
+		events of the same type are delivered in order of their publication within each thread. Events of any type that
+		are published by listeners during Tick() are dispatched on the next one. Listeners shouldn't call Tick() themselves.
+
+		A queue is created for each thread that publishes into the bus, Tick() releases queues of exited threads
+		after their last events are dispatched. Publish() shouldn't be called from destructors of thread_local objects.
+	*/
+
+	template <typename... TEvents>
+	class EventBus final
+	{
+		public:
+			template <typename TEvent> using TChannelDelegate = Delegate<const TEvent&>;
+
+		public:
+			EventBus() DELEGATE_NOEXCEPT : mId(_getNextBusId()) {}
+			~EventBus() DELEGATE_NOEXCEPT = default;
+
+			template <typename TEvent, typename TCallable>
+			TSubscriptionHandle Subscribe(TCallable&& listener, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				return GetChannel<TEvent>().Subscribe(std::forward<TCallable>(listener), priority);
+			}
+
+			/// \note The listener receives all events of the type which are dispatched within a single Tick() at once
+			template <typename TEvent, typename TCallable>
+			TSubscriptionHandle SubscribeBatch(TCallable&& listener, int32_t priority = 0) DELEGATE_NOEXCEPT
+			{
+				return GetChannel<TEvent>().SubscribeBatch(std::forward<TCallable>(listener), priority);
+			}
+
+			template <typename TEvent>
+			bool Unsubscribe(TSubscriptionHandle handle) DELEGATE_NOEXCEPT
+			{
+				return GetChannel<TEvent>().Unsubscribe(handle);
+			}
+
+			/// \note Dispatches the event immediately within the calling thread
+			template <typename TEvent>
+			void Notify(const TEvent& event) DELEGATE_NOEXCEPT
+			{
+				TChannel<TEvent>& channel = _getChannel<TEvent>();
+
+				channel.mPublishedCount.fetch_add(1, std::memory_order_relaxed);
+				channel.mDelegate.Notify(event);
+				channel.mDispatchedCount.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/// \note Puts the event into the calling thread's queue, it'll be dispatched by the next Tick()
+			template <typename T>
+			void Publish(T&& event) DELEGATE_NOEXCEPT
+			{
+				using TEvent = typename std::decay<T>::type;
+
+				TThreadQueue& queue = _getThreadQueue();
+
+				{
+					std::lock_guard<std::mutex> lock(queue.mMutex);
+					std::get<TTypeIndex<TEvent, TEvents...>::value>(queue.mEvents).emplace_back(std::forward<T>(event));
+				}
+
+				_getChannel<TEvent>().mPublishedCount.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			/// \note Dispatches all events which were published since the previous call, returns their number
+			size_t Tick() DELEGATE_NOEXCEPT
+			{
+				std::lock_guard<std::mutex> tickLock(mTickMutex);
+
+				{
+					std::lock_guard<std::mutex> lock(mQueuesMutex);
+
+					mTickQueues.clear();
+
+					for (auto&& pCurrQueue : mThreadQueues)
+					{
+						/// \note The thread has exited before its queue is drained, so the queue won't get new events
+						pCurrQueue->mHasThreadExited = pCurrQueue->mThreadToken.expired();
+						mTickQueues.push_back(pCurrQueue.get());
+					}
+				}
+
+				/// \note All queues are drained before any dispatch, so events published by listeners wait for the next tick
+				for (TThreadQueue* pCurrQueue : mTickQueues)
+				{
+					std::lock_guard<std::mutex> lock(pCurrQueue->mMutex);
+					_collectEvents(*pCurrQueue, std::index_sequence_for<TEvents...>());
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(mQueuesMutex);
+
+					mThreadQueues.erase(std::remove_if(mThreadQueues.begin(), mThreadQueues.end(), [](const std::unique_ptr<TThreadQueue>& pQueue)
+					{
+						return pQueue->mHasThreadExited;
+					}), mThreadQueues.end());
+				}
+
+				mTickQueues.clear();
+
+				return _dispatchChannels(std::index_sequence_for<TEvents...>());
+			}
+
+			/// \note The number of queues of threads which have published into the bus and haven't been released yet
+			size_t GetThreadQueuesCount() DELEGATE_NOEXCEPT
+			{
+				std::lock_guard<std::mutex> lock(mQueuesMutex);
+				return mThreadQueues.size();
+			}
+
+			template <typename TEvent>
+			TChannelDelegate<TEvent>& GetChannel() DELEGATE_NOEXCEPT { return _getChannel<TEvent>().mDelegate; }
+
+			template <typename TEvent>
+			TEventBusStats GetStats() const DELEGATE_NOEXCEPT
+			{
+				const TChannel<TEvent>& channel = std::get<TTypeIndex<TEvent, TEvents...>::value>(mChannels);
+
+				TEventBusStats stats;
+				stats.mPublishedCount = channel.mPublishedCount.load(std::memory_order_relaxed);
+				stats.mDispatchedCount = channel.mDispatchedCount.load(std::memory_order_relaxed);
+
+				return stats;
+			}
+
+			EventBus(const EventBus&) = delete;
+			EventBus& operator= (const EventBus&) = delete;
+		private:
+			static constexpr size_t mCachedBusesCount = 4;
+
+			template <typename TEvent>
+			struct TChannel
+			{
+				TChannelDelegate<TEvent> mDelegate;
+
+				std::vector<TEvent> mPendingEvents;	///< Events of all threads which are dispatched by the current Tick()
+
+				std::atomic<uint64_t> mPublishedCount { 0 };
+				std::atomic<uint64_t> mDispatchedCount { 0 };
+			};
+
+			struct TThreadQueue
+			{
+				std::mutex mMutex;
+				std::tuple<std::vector<TEvents>...> mEvents;
+				std::weak_ptr<void> mThreadToken;	///< Expires when the owning thread exits
+				bool mHasThreadExited = false;
+			};
+
+			/// \note Queues of the last buses the thread has published into, ids are never reused unlike addresses of buses
+			struct TThreadQueueCache
+			{
+				uint64_t mBusIds[mCachedBusesCount] = {};
+				TThreadQueue* mpQueues[mCachedBusesCount] = {};
+
+				size_t mNextEntryIndex = 0;	///< Entries are replaced in round-robin order
+			};
+		private:
+			static uint64_t _getNextBusId() DELEGATE_NOEXCEPT
+			{
+				static std::atomic<uint64_t> nextBusId { 1 };
+				return nextBusId.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			template <typename TEvent>
+			TChannel<TEvent>& _getChannel() DELEGATE_NOEXCEPT { return std::get<TTypeIndex<TEvent, TEvents...>::value>(mChannels); }
+
+			TThreadQueue& _getThreadQueue() DELEGATE_NOEXCEPT
+			{
+				static thread_local TThreadQueueCache cache;
+
+				for (size_t i = 0; i < mCachedBusesCount; ++i)
+				{
+					if (cache.mBusIds[i] == mId)
+					{
+						return *cache.mpQueues[i];
+					}
+				}
+
+				const std::shared_ptr<void>& pThreadToken = _getThreadToken();
+
+				std::lock_guard<std::mutex> lock(mQueuesMutex);
+
+				/// \note Tokens of exited threads are expired, so a new thread never adopts a queue that is going to be released
+				auto it = std::find_if(mThreadQueues.begin(), mThreadQueues.end(), [&pThreadToken](const std::unique_ptr<TThreadQueue>& pQueue)
+				{
+					return pQueue->mThreadToken.lock() == pThreadToken;
+				});
+
+				if (it == mThreadQueues.end())
+				{
+					mThreadQueues.emplace_back(new TThreadQueue());
+					mThreadQueues.back()->mThreadToken = pThreadToken;
+
+					it = std::prev(mThreadQueues.end());
+				}
+
+				const size_t entryIndex = cache.mNextEntryIndex;
+				cache.mNextEntryIndex = (entryIndex + 1) % mCachedBusesCount;
+
+				cache.mBusIds[entryIndex] = mId;
+				cache.mpQueues[entryIndex] = it->get();
+
+				return *it->get();
+			}
+
+			/// \note The token is owned by the thread only, so it's destroyed when the thread exits
+			static const std::shared_ptr<void>& _getThreadToken() DELEGATE_NOEXCEPT
+			{
+				static thread_local const std::shared_ptr<void> pToken = std::make_shared<char>(0);
+				return pToken;
+			}
+
+			template <size_t... Indices>
+			void _collectEvents(TThreadQueue& queue, std::index_sequence<Indices...>) DELEGATE_NOEXCEPT
+			{
+				const int dummy[] = { 0, (_collectEventsOfType<Indices>(queue), 0)... };
+				(void)dummy;
+			}
+
+			template <size_t Index>
+			void _collectEventsOfType(TThreadQueue& queue) DELEGATE_NOEXCEPT
+			{
+				auto& pendingEvents = std::get<Index>(mChannels).mPendingEvents;
+				auto& threadEvents = std::get<Index>(queue.mEvents);
+
+				if (threadEvents.empty())
+				{
+					return;
+				}
+
+				/// \note Swapping gives the thread the cleared buffer of the previous tick back, so nothing is allocated
+				if (pendingEvents.empty())
+				{
+					pendingEvents.swap(threadEvents);
+					return;
+				}
+
+				pendingEvents.insert(pendingEvents.end(), std::make_move_iterator(threadEvents.begin()), std::make_move_iterator(threadEvents.end()));
+				threadEvents.clear();
+			}
+
+			template <size_t... Indices>
+			size_t _dispatchChannels(std::index_sequence<Indices...>) DELEGATE_NOEXCEPT
+			{
+				size_t dispatchedEventsCount = 0;
+
+				const size_t counts[] = { 0, _dispatchChannel<Indices>()... };
+
+				for (size_t currCount : counts)
+				{
+					dispatchedEventsCount += currCount;
+				}
+
+				return dispatchedEventsCount;
+			}
+
+			template <size_t Index>
+			size_t _dispatchChannel() DELEGATE_NOEXCEPT
+			{
+				auto& channel = std::get<Index>(mChannels);
+				auto& pendingEvents = channel.mPendingEvents;
+
+				const size_t eventsCount = pendingEvents.size();
+
+				if (eventsCount)
+				{
+					channel.mDelegate.NotifyBatch(pendingEvents);
+					channel.mDispatchedCount.fetch_add(eventsCount, std::memory_order_relaxed);
+
+					pendingEvents.clear();
+				}
+
+				return eventsCount;
+			}
+		private:
+			const uint64_t mId;
+
+			std::tuple<TChannel<TEvents>...> mChannels;
+
+			std::vector<std::unique_ptr<TThreadQueue>> mThreadQueues;
+			std::vector<TThreadQueue*> mTickQueues;
+
+			std::mutex mQueuesMutex;
+			std::mutex mTickMutex;
+	};
+}
@@ -23,6 +23,8 @@
 
 
 #include <type_traits>
+#include <utility>
+#include <new>
 #include <iostream>
 #include <string>
 
@@ -80,6 +82,27 @@ namespace Wrench
 	};
 
 
+	/// \brief The function wraps a value to construct a successful Result<T, E> from it without copies, e.g. return Ok(std::move(values));
+	template <typename T>
+	TOkValue<typename std::decay<T>::type> Ok(T&& value) RESULT_NOEXCEPT
+	{
+		return TOkValue<typename std::decay<T>::type>(std::forward<T>(value));
+	}
+
+	inline TOkValue<void> Ok() RESULT_NOEXCEPT { return {}; }
+
+	template <typename E>
+	TErrValue<typename std::decay<E>::type> Err(E&& error) RESULT_NOEXCEPT
+	{
+		return TErrValue<typename std::decay<E>::type>(std::forward<E>(error));
+	}
+
+
+	/// \note The tags select what Storage<T, E> and Result<T, E> construct in-place, a value or an error
+	struct TOkTag {};
+	struct TErrTag {};
+
+
 	template <typename T, typename E>
 	class Storage final
 	{
@@ -87,22 +110,43 @@ namespace Wrench
 
 		public:
 			static constexpr size_t mSize = (sizeof(T) > sizeof(E)) ? sizeof(T) : sizeof(E);
-			static constexpr size_t mAlignment = (alignof(T) > alignof(E)) ? alignof(E) : alignof(E);
+			static constexpr size_t mAlignment = (alignof(T) > alignof(E)) ? alignof(T) : alignof(E);
 
 			using StorageImpl = typename std::aligned_storage<mSize, mAlignment>::type;
 		public:
 			Storage() RESULT_NOEXCEPT : mIsInitialized(false), mIsValid(false) { }
 
-			Storage(const TOkValue<T>& value) RESULT_NOEXCEPT :
+			Storage(const TOkValue<T>& value) RESULT_NOEXCEPT : Storage(TOkTag(), value.mValue) { }
+			Storage(TOkValue<T>&& value) RESULT_NOEXCEPT : Storage(TOkTag(), std::move(value.mValue)) { }
+
+			Storage(const TErrValue<E>& value) RESULT_NOEXCEPT : Storage(TErrTag(), value.mError) { }
+			Storage(TErrValue<E>&& value) RESULT_NOEXCEPT : Storage(TErrTag(), std::move(value.mError)) { }
+
+			template <typename... TArgs>
+			Storage(TOkTag, TArgs&&... args) RESULT_NOEXCEPT :
 				mIsInitialized(true), mIsValid(true)
 			{ 
-				new (&mData) T(value.mValue);
+				new (&mData) T(std::forward<TArgs>(args)...);
 			}
 
-			Storage(const TErrValue<E>& value) RESULT_NOEXCEPT :
+			template <typename... TArgs>
+			Storage(TErrTag, TArgs&&... args) RESULT_NOEXCEPT :
 				mIsInitialized(true), mIsValid(false)
 			{
-				new (&mData) E(value.mError);
+				new (&mData) E(std::forward<TArgs>(args)...);
+			}
+
+			Storage(const Storage& other) RESULT_NOEXCEPT :
+				Storage()
+			{
+				_copyFrom(other);
+			}
+
+			/// \note The moved-from storage keeps a moved-from value or error
+			Storage(Storage&& other) RESULT_NOEXCEPT :
+				Storage()
+			{
+				_moveFrom(other);
 			}
 
 			~Storage() RESULT_NOEXCEPT
@@ -110,29 +154,54 @@ namespace Wrench
 				_release();
 			}
 
-			void Reset(const TOkValue<T>& value) RESULT_NOEXCEPT
+			Storage& operator= (const Storage& other) RESULT_NOEXCEPT
 			{
-				if (mIsInitialized)
+				if (this != &other)
 				{
 					_release();
+					_copyFrom(other);
 				}
 
-				new (&mData) T(value.mValue);
-
-				mIsInitialized = true;
-				mIsValid = true;
+				return *this;
 			}
 
-			void Reset(const TErrValue<E>& value) RESULT_NOEXCEPT
+			Storage& operator= (Storage&& other) RESULT_NOEXCEPT
 			{
-				if (mIsInitialized)
+				if (this != &other)
 				{
 					_release();
+					_moveFrom(other);
 				}
 
-				new (&mData) E(value.mError);
+				return *this;
+			}
+
+			void Reset(const TOkValue<T>& value) RESULT_NOEXCEPT { Emplace(TOkTag(), value.mValue); }
+			void Reset(TOkValue<T>&& value) RESULT_NOEXCEPT { Emplace(TOkTag(), std::move(value.mValue)); }
+
+			void Reset(const TErrValue<E>& value) RESULT_NOEXCEPT { Emplace(TErrTag(), value.mError); }
+			void Reset(TErrValue<E>&& value) RESULT_NOEXCEPT { Emplace(TErrTag(), std::move(value.mError)); }
+
+			template <typename... TArgs>
+			void Emplace(TOkTag, TArgs&&... args) RESULT_NOEXCEPT
+			{
+				_release();
+
+				new (&mData) T(std::forward<TArgs>(args)...);
 
 				mIsInitialized = true;
+				mIsValid = true;
+			}
+
+			template <typename... TArgs>
+			void Emplace(TErrTag, TArgs&&... args) RESULT_NOEXCEPT
+			{
+				_release();
+
+				new (&mData) E(std::forward<TArgs>(args)...);
+
+				mIsInitialized = true;
+				mIsValid = false;
 			}
 
 			template <typename U>
@@ -150,6 +219,38 @@ namespace Wrench
 			bool IsValid() const RESULT_NOEXCEPT { return mIsValid; }
 
 		private:
+			void _copyFrom(const Storage& other) RESULT_NOEXCEPT
+			{
+				if (!other.mIsInitialized)
+				{
+					return;
+				}
+
+				if (other.mIsValid)
+				{
+					Emplace(TOkTag(), other.GetAs<T>());
+					return;
+				}
+
+				Emplace(TErrTag(), other.GetAs<E>());
+			}
+
+			void _moveFrom(Storage& other) RESULT_NOEXCEPT
+			{
+				if (!other.mIsInitialized)
+				{
+					return;
+				}
+
+				if (other.mIsValid)
+				{
+					Emplace(TOkTag(), std::move(other.GetAs<T>()));
+					return;
+				}
+
+				Emplace(TErrTag(), std::move(other.GetAs<E>()));
+			}
+
 			void _release() RESULT_NOEXCEPT
 			{
 				if (mIsInitialized)
@@ -187,15 +288,34 @@ namespace Wrench
 		public:
 			Storage() RESULT_NOEXCEPT : mIsInitialized(false), mIsValid(false) { }
 
-			Storage(const TOkValue<void>& value) RESULT_NOEXCEPT :
+			Storage(const TOkValue<void>&) RESULT_NOEXCEPT : Storage(TOkTag()) { }
+
+			Storage(const TErrValue<E>& value) RESULT_NOEXCEPT : Storage(TErrTag(), value.mError) { }
+			Storage(TErrValue<E>&& value) RESULT_NOEXCEPT : Storage(TErrTag(), std::move(value.mError)) { }
+
+			Storage(TOkTag) RESULT_NOEXCEPT :
 				mIsInitialized(true), mIsValid(true)
 			{
 			}
 
-			Storage(const TErrValue<E>& value) RESULT_NOEXCEPT :
+			template <typename... TArgs>
+			Storage(TErrTag, TArgs&&... args) RESULT_NOEXCEPT :
 				mIsInitialized(true), mIsValid(false)
 			{
-				new (&mData) E(value.mError);
+				new (&mData) E(std::forward<TArgs>(args)...);
+			}
+
+			Storage(const Storage& other) RESULT_NOEXCEPT :
+				Storage()
+			{
+				_copyFrom(other);
+			}
+
+			/// \note The moved-from storage keeps a moved-from error
+			Storage(Storage&& other) RESULT_NOEXCEPT :
+				Storage()
+			{
+				_moveFrom(other);
 			}
 
 			~Storage() RESULT_NOEXCEPT
@@ -203,31 +323,60 @@ namespace Wrench
 				_release();
 			}
 
-			void Reset(const TOkValue<void>& value) RESULT_NOEXCEPT
+			Storage& operator= (const Storage& other) RESULT_NOEXCEPT
 			{
-				if (mIsInitialized)
+				if (this != &other)
 				{
 					_release();
+					_copyFrom(other);
 				}
 
-				mIsInitialized = true;
-				mIsValid = true;
+				return *this;
 			}
 
-			void Reset(const TErrValue<E>& value) RESULT_NOEXCEPT
+			Storage& operator= (Storage&& other) RESULT_NOEXCEPT
 			{
-				if (mIsInitialized)
+				if (this != &other)
 				{
 					_release();
+					_moveFrom(other);
 				}
 
-				new (&mData) E(value.mError);
+				return *this;
+			}
+
+			void Reset(const TOkValue<void>&) RESULT_NOEXCEPT { Emplace(TOkTag()); }
+
+			void Reset(const TErrValue<E>& value) RESULT_NOEXCEPT { Emplace(TErrTag(), value.mError); }
+			void Reset(TErrValue<E>&& value) RESULT_NOEXCEPT { Emplace(TErrTag(), std::move(value.mError)); }
+
+			void Emplace(TOkTag) RESULT_NOEXCEPT
+			{
+				_release();
 
 				mIsInitialized = true;
+				mIsValid = true;
+			}
+
+			template <typename... TArgs>
+			void Emplace(TErrTag, TArgs&&... args) RESULT_NOEXCEPT
+			{
+				_release();
+
+				new (&mData) E(std::forward<TArgs>(args)...);
+
+				mIsInitialized = true;
+				mIsValid = false;
 			}
 
 			template <typename U>
 			const U& GetAs() const RESULT_NOEXCEPT
+			{
+				return *reinterpret_cast<const U*>(&mData);
+			}
+
+			template <typename U>
+			U& GetAs() RESULT_NOEXCEPT
 			{
 				return *reinterpret_cast<U*>(&mData);
 			}
@@ -235,6 +384,38 @@ namespace Wrench
 			bool IsValid() const RESULT_NOEXCEPT { return mIsValid; }
 
 		private:
+			void _copyFrom(const Storage& other) RESULT_NOEXCEPT
+			{
+				if (!other.mIsInitialized)
+				{
+					return;
+				}
+
+				if (other.mIsValid)
+				{
+					Emplace(TOkTag());
+					return;
+				}
+
+				Emplace(TErrTag(), other.GetAs<E>());
+			}
+
+			void _moveFrom(Storage& other) RESULT_NOEXCEPT
+			{
+				if (!other.mIsInitialized)
+				{
+					return;
+				}
+
+				if (other.mIsValid)
+				{
+					Emplace(TOkTag());
+					return;
+				}
+
+				Emplace(TErrTag(), std::move(other.GetAs<E>()));
+			}
+
 			void _release() RESULT_NOEXCEPT
 			{
 				if (mIsInitialized)
@@ -269,18 +450,42 @@ namespace Wrench
 			Result() RESULT_NOEXCEPT = delete;
 
 			Result(const TOkValue<T>& value) RESULT_NOEXCEPT : mData(value) { }
+			Result(TOkValue<T>&& value) RESULT_NOEXCEPT : mData(std::move(value)) { }
+
 			Result(const TErrValue<E>& error) RESULT_NOEXCEPT : mData(error) { }
+			Result(TErrValue<E>&& error) RESULT_NOEXCEPT : mData(std::move(error)) { }
+
+			/// \note The constructors build a value or an error in-place from the given arguments
+			template <typename... TArgs>
+			Result(TOkTag tag, TArgs&&... args) RESULT_NOEXCEPT : mData(tag, std::forward<TArgs>(args)...) { }
+
+			template <typename... TArgs>
+			Result(TErrTag tag, TArgs&&... args) RESULT_NOEXCEPT : mData(tag, std::forward<TArgs>(args)...) { }
 
 			Result(const Result& result) RESULT_NOEXCEPT : mData(result.mData) { }
 			Result(Result&& result) RESULT_NOEXCEPT : mData(std::move(result.mData)) { }
 
 			~Result() RESULT_NOEXCEPT = default;
 
+			/// Factories
+
+			template <typename... TArgs>
+			static Result<T, E> Ok(TArgs&&... args) RESULT_NOEXCEPT
+			{
+				return Result<T, E>(TOkTag(), std::forward<TArgs>(args)...);
+			}
+
+			template <typename... TArgs>
+			static Result<T, E> Err(TArgs&&... args) RESULT_NOEXCEPT
+			{
+				return Result<T, E>(TErrTag(), std::forward<TArgs>(args)...);
+			}
+
 			/// Methods
 
 			template <typename U = T>
-			typename std::enable_if<!std::is_same<U, void>::value, U>::type
-				Get() const RESULT_NOEXCEPT
+			typename std::enable_if<!std::is_same<U, void>::value, const U&>::type
+				Get() const & RESULT_NOEXCEPT
 			{
 				if (!mData.IsValid())
 				{
@@ -290,13 +495,60 @@ namespace Wrench
 				return mData.template GetAs<U>();
 			}
 
+			/// \note The value is moved out of a temporary result
+			template <typename U = T>
+			typename std::enable_if<!std::is_same<U, void>::value, U>::type
+				Get() && RESULT_NOEXCEPT
+			{
+				if (!mData.IsValid())
+				{
+					Panic("[Result<T, E>] Get() was invoked for an invalid Result<T, E> object");
+				}
+
+				return std::move(mData.template GetAs<U>());
+			}
+
+			/*!
+				\brief The method consumes the result and moves its value out, a program is stopped if there is an error
+
+				\code
+					auto values = LoadValues().Unwrap();
+					auto otherValues = std::move(otherResult).Unwrap();
+				\endcode
+			*/
+
 			template <typename U = T>
 			typename std::enable_if<!std::is_same<U, void>::value, U>::type
-				GetOrDefault(U&& altValue) RESULT_NOEXCEPT
+				Unwrap() && RESULT_NOEXCEPT
 			{
 				if (!mData.IsValid())
 				{
-					return std::forward<U>(altValue);
+					Panic("[Result<T, E>] Unwrap() was invoked for an invalid Result<T, E> object");
+				}
+
+				return std::move(mData.template GetAs<U>());
+			}
+
+			/// \note The alternative value is converted into T, U isn't deduced and always equals T
+			template <typename TAltValue, typename U = T>
+			typename std::enable_if<!std::is_same<U, void>::value, U>::type
+				GetOrDefault(TAltValue&& altValue) RESULT_NOEXCEPT
+			{
+				if (!mData.IsValid())
+				{
+					return static_cast<U>(std::forward<TAltValue>(altValue));
+				}
+
+				return mData.template GetAs<U>();
+			}
+
+			template <typename U = E>
+			typename std::enable_if<!std::is_same<U, void>::value, const U&>::type
+				GetError() const & RESULT_NOEXCEPT
+			{
+				if (mData.IsValid())
+				{
+					Panic("[Result<T, E>] GetError() was invoked for a valid Result<T, E> object");
 				}
 
 				return mData.template GetAs<U>();
@@ -304,16 +556,71 @@ namespace Wrench
 
 			template <typename U = E>
 			typename std::enable_if<!std::is_same<U, void>::value, U>::type
-				GetError() const RESULT_NOEXCEPT
+				GetError() && RESULT_NOEXCEPT
 			{
 				if (mData.IsValid())
 				{
 					Panic("[Result<T, E>] GetError() was invoked for a valid Result<T, E> object");
 				}
 
+				return std::move(mData.template GetAs<U>());
+			}
+
+			/// \note The alternative value is converted into T, U isn't deduced and always equals T
+			template <typename TAltValue, typename U = T>
+			typename std::enable_if<!std::is_same<U, void>::value, U>::type
+				ValueOr(TAltValue&& altValue) const & RESULT_NOEXCEPT
+			{
+				if (!mData.IsValid())
+				{
+					return static_cast<U>(std::forward<TAltValue>(altValue));
+				}
+
 				return mData.template GetAs<U>();
 			}
 
+			template <typename TAltValue, typename U = T>
+			typename std::enable_if<!std::is_same<U, void>::value, U>::type
+				ValueOr(TAltValue&& altValue) && RESULT_NOEXCEPT
+			{
+				if (!mData.IsValid())
+				{
+					return static_cast<U>(std::forward<TAltValue>(altValue));
+				}
+
+				return std::move(mData.template GetAs<U>());
+			}
+
+			/*!
+				\brief Combinators pass the value or the error into the next step, a temporary result moves them, e.g.
+
+				\code
+					Result<TConfig, TError> config = ReadFile(path)
+						.AndThen([](std::string&& text) { return ParseConfig(text); })
+						.Map([](TConfig&& config) { return Validate(std::move(config)); })
+						.MapError([](TError&& error) { return TError { "Couldn't load the config: " + error.mMessage }; });
+				\endcode
+
+				Map(f) transforms the value with f(T) -> U, the error is kept, so the result is Result<U, E>.
+				MapError(f) transforms the error with f(E) -> F, the value is kept, so the result is Result<T, F>.
+				AndThen(f) invokes f(T) -> Result<U, E> for a value only, the error is passed through.
+				OrElse(f) invokes f(E) -> Result<T, F> for an error only, the value is passed through.
+
+				A function gets no arguments instead of a value for Result<void, E>.
+			*/
+
+			template <typename TFunction> auto Map(TFunction&& function) const & RESULT_NOEXCEPT { return _map(*this, function); }
+			template <typename TFunction> auto Map(TFunction&& function) && RESULT_NOEXCEPT { return _map(std::move(*this), function); }
+
+			template <typename TFunction> auto MapError(TFunction&& function) const & RESULT_NOEXCEPT { return _mapError(*this, function); }
+			template <typename TFunction> auto MapError(TFunction&& function) && RESULT_NOEXCEPT { return _mapError(std::move(*this), function); }
+
+			template <typename TFunction> auto AndThen(TFunction&& function) const & RESULT_NOEXCEPT { return _andThen(*this, function); }
+			template <typename TFunction> auto AndThen(TFunction&& function) && RESULT_NOEXCEPT { return _andThen(std::move(*this), function); }
+
+			template <typename TFunction> auto OrElse(TFunction&& function) const & RESULT_NOEXCEPT { return _orElse(*this, function); }
+			template <typename TFunction> auto OrElse(TFunction&& function) && RESULT_NOEXCEPT { return _orElse(std::move(*this), function); }
+
 			bool IsOk() const RESULT_NOEXCEPT { return mData.IsValid(); }
 			bool HasError() const RESULT_NOEXCEPT { return !mData.IsValid(); }
 
@@ -325,26 +632,176 @@ namespace Wrench
 				return *this;
 			}
 
+			Result<T, E>& operator= (TOkValue<T>&& value) RESULT_NOEXCEPT
+			{
+				mData.Reset(std::move(value));
+				return *this;
+			}
+
 			Result<T, E>& operator= (const TErrValue<E>& error) RESULT_NOEXCEPT
 			{
 				mData.Reset(error);
 				return *this;
 			}
 
+			Result<T, E>& operator= (TErrValue<E>&& error) RESULT_NOEXCEPT
+			{
+				mData.Reset(std::move(error));
+				return *this;
+			}
+
 			Result<T, E>& operator= (const Result<T, E>& result) RESULT_NOEXCEPT
 			{
-				mData.Reset(result.mData);
+				mData = result.mData;
 				return *this;
 			}
 
 			Result<T, E>& operator= (Result<T, E>&& result) RESULT_NOEXCEPT
 			{
-				std::swap(mData, result.mData);
+				mData = std::move(result.mData);
 				return *this;
 			}
 
 			operator bool() const RESULT_NOEXCEPT { return mData.IsValid(); }
+		private:
+			/// \note Moves the value if the result is a temporary one
+			template <typename TSelf, typename U>
+			static typename std::enable_if<std::is_lvalue_reference<TSelf>::value, U&>::type _forward(U& value) RESULT_NOEXCEPT { return value; }
+
+			template <typename TSelf, typename U>
+			static typename std::enable_if<!std::is_lvalue_reference<TSelf>::value, U&&>::type _forward(U& value) RESULT_NOEXCEPT { return std::move(value); }
+
+			template <typename TSelf, typename TFunction, typename U = T>
+			static decltype(auto) _invokeWithValue(TSelf&& self, TFunction& function, std::false_type) RESULT_NOEXCEPT
+			{
+				return function(_forward<TSelf>(self.mData.template GetAs<U>()));
+			}
+
+			template <typename TSelf, typename TFunction>
+			static decltype(auto) _invokeWithValue(TSelf&&, TFunction& function, std::true_type) RESULT_NOEXCEPT
+			{
+				return function();
+			}
+
+			template <typename TSelf, typename TFunction>
+			static decltype(auto) _invokeWithError(TSelf&& self, TFunction& function) RESULT_NOEXCEPT
+			{
+				return function(_forward<TSelf>(self.mData.template GetAs<E>()));
+			}
+
+			/// \note The methods build a successful result of another type from the value of the current one
+			template <typename TResult, typename TSelf, typename U = T>
+			static TResult _passValue(TSelf&& self, std::false_type) RESULT_NOEXCEPT { return TResult::Ok(_forward<TSelf>(self.mData.template GetAs<U>())); }
+
+			template <typename TResult, typename TSelf>
+			static TResult _passValue(TSelf&&, std::true_type) RESULT_NOEXCEPT { return TResult::Ok(); }
+
+			template <typename TResult, typename TInvoke>
+			static TResult _wrapValue(TInvoke&& invoke, std::false_type) RESULT_NOEXCEPT { return TResult::Ok(invoke()); }
+
+			template <typename TResult, typename TInvoke>
+			static TResult _wrapValue(TInvoke&& invoke, std::true_type) RESULT_NOEXCEPT
+			{
+				invoke();
+				return TResult::Ok();
+			}
+
+			template <typename TSelf, typename TFunction>
+			static auto _map(TSelf&& self, TFunction& function) RESULT_NOEXCEPT
+			{
+				using TValue = decltype(_invokeWithValue(std::forward<TSelf>(self), function, std::is_void<T>()));
+				using TMappedResult = Result<typename std::decay<TValue>::type, E>;
+
+				if (!self.IsOk())
+				{
+					return TMappedResult::Err(_forward<TSelf>(self.mData.template GetAs<E>()));
+				}
+
+				return _wrapValue<TMappedResult>([&self, &function]() -> TValue
+				{
+					return _invokeWithValue(std::forward<TSelf>(self), function, std::is_void<T>());
+				}, std::is_void<TValue>());
+			}
+
+			template <typename TSelf, typename TFunction>
+			static auto _mapError(TSelf&& self, TFunction& function) RESULT_NOEXCEPT
+			{
+				using TMappedResult = Result<T, typename std::decay<decltype(_invokeWithError(std::forward<TSelf>(self), function))>::type>;
+
+				if (self.IsOk())
+				{
+					return _passValue<TMappedResult>(std::forward<TSelf>(self), std::is_void<T>());
+				}
+
+				return TMappedResult::Err(_invokeWithError(std::forward<TSelf>(self), function));
+			}
+
+			template <typename TSelf, typename TFunction>
+			static auto _andThen(TSelf&& self, TFunction& function) RESULT_NOEXCEPT
+			{
+				using TNextResult = typename std::decay<decltype(_invokeWithValue(std::forward<TSelf>(self), function, std::is_void<T>()))>::type;
+
+				if (!self.IsOk())
+				{
+					return TNextResult::Err(_forward<TSelf>(self.mData.template GetAs<E>()));
+				}
+
+				return TNextResult(_invokeWithValue(std::forward<TSelf>(self), function, std::is_void<T>()));
+			}
+
+			template <typename TSelf, typename TFunction>
+			static auto _orElse(TSelf&& self, TFunction& function) RESULT_NOEXCEPT
+			{
+				using TNextResult = typename std::decay<decltype(_invokeWithError(std::forward<TSelf>(self), function))>::type;
+
+				if (self.IsOk())
+				{
+					return _passValue<TNextResult>(std::forward<TSelf>(self), std::is_void<T>());
+				}
+
+				return TNextResult(_invokeWithError(std::forward<TSelf>(self), function));
+			}
 		private:
 			ResultStorage mData;
 	};
-}
\ No newline at end of file
+}
+
+
+#define WRENCH_RESULT_CONCAT_IMPL(left, right) left##right
+#define WRENCH_RESULT_CONCAT(left, right) WRENCH_RESULT_CONCAT_IMPL(left, right)
+
+/*!
+	\brief The macro returns the error of the given result from the enclosing function, which should return
+	a Result with the same error type. WRENCH_TRY_ASSIGN also declares a variable initialized with the value, e.g.
+
+	\code
+		Result<TConfig, TError> LoadConfig(const std::string& path)
+		{
+			WRENCH_TRY(CheckPath(path));
+			WRENCH_TRY_ASSIGN(std::string text, ReadFile(path));
+
+			return ParseConfig(text);
+		}
+	\endcode
+
+	\note Only the result expression may contain commas. The declaration is the first macro argument, so it
+	shouldn't contain an unparenthesized comma, use auto or a type alias instead, e.g. WRENCH_TRY_ASSIGN(auto pair, ...)
+*/
+
+#define WRENCH_TRY(...) \
+	do \
+	{ \
+		auto&& wrenchTryResult = (__VA_ARGS__); \
+		if (wrenchTryResult.HasError()) \
+		{ \
+			return ::Wrench::Err(std::forward<decltype(wrenchTryResult)>(wrenchTryResult).GetError()); \
+		} \
+	} while (0)
+
+#define WRENCH_TRY_ASSIGN(declaration, ...) \
+	auto&& WRENCH_RESULT_CONCAT(wrenchTryResult, __LINE__) = (__VA_ARGS__); \
+	if (WRENCH_RESULT_CONCAT(wrenchTryResult, __LINE__).HasError()) \
+	{ \
+		return ::Wrench::Err(std::forward<decltype(WRENCH_RESULT_CONCAT(wrenchTryResult, __LINE__))>(WRENCH_RESULT_CONCAT(wrenchTryResult, __LINE__)).GetError()); \
+	} \
+	declaration = std::forward<decltype(WRENCH_RESULT_CONCAT(wrenchTryResult, __LINE__))>(WRENCH_RESULT_CONCAT(wrenchTryResult, __LINE__)).Get()
@@ -0,0 +1,544 @@
+/*!
+	\file serialization.hpp
+	\date 17.10.2026
+	\author Ildar Kasimov
+
+	The library implements a compact binary serialization of Variant and Result types into a contiguous buffer.
+	A variant is written as its type index of the smallest sufficient size followed by the current value, a result
+	is written as a byte with an ok bit followed by either a value or an error.
+
+	Trivially copyable values are written as is, aligned to their natural alignment relative to the beginning of
+	a buffer, so they can be read without copying via BinaryReader::ReadView<T>(). Arrays of trivially copyable
+	values, including variants with trivially copyable alternatives only, are written with a single memcpy.
+	Such values are checked by TSerializedValuesValidator<T> when they are read, which rejects variants with
+	corrupted type indices and bools other than 0 and 1. Any other type is considered valid for every bit pattern,
+	so an enumeration or a type with invariants should get its own specialization of the validator or it
+	could be read as an invalid value.
+
+	The format is intended for an exchange between processes of the same build, bytes' order and types' layouts
+	aren't converted. The usage of the library is pretty simple, just copy this file along with variant.hpp and
+	result.hpp into your enviornment and include it
+
+	\code
+		#include "serialization.hpp"
+
+		std::vector<uint8_t> buffer;
+
+		Wrench::BinaryWriter writer(buffer);
+		writer.Write(Wrench::Variant<int, std::string>(42));
+
+		Wrench::BinaryReader reader(buffer);
+
+		Wrench::Variant<int, std::string> value;
+		reader.Read(value);
+	\endcode
+
+	A custom type becomes serializable with a specialization of TSerializer<T> that provides static Write and Read
+	methods. Read methods return false if the buffer doesn't contain a correct value.
+*/
+
+#pragma once
+
+
+#include "variant.hpp"
+#include "result.hpp"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+
+namespace Wrench
+{
+	class BinaryWriter;
+	class BinaryReader;
+
+
+	/// \note The primary template serializes trivially copyable types only, specialize it for other ones
+	template <typename T, typename = void>
+	struct TSerializer;
+
+
+	/// \note Values of such types are copied into and out of a buffer as is
+	template <typename T> struct TIsTriviallySerializable : std::is_trivially_copyable<T> {};
+	template <typename... TArgs> struct TIsTriviallySerializable<Variant<TArgs...>> : std::integral_constant<bool, TIsTriviallyCopyable<TArgs...>::mValue> {};
+
+
+	/// \brief The validator checks values which were copied out of a buffer as is, any bytes are correct values by default
+	template <typename T>
+	struct TSerializedValuesValidator
+	{
+		static bool IsValid(const T*, size_t) VARIANT_NOEXCEPT { return true; }
+	};
+
+	/// \note Any byte except 0 and 1 isn't a valid bool
+	template <>
+	struct TSerializedValuesValidator<bool>
+	{
+		static bool IsValid(const bool* pValues, size_t count) VARIANT_NOEXCEPT
+		{
+			const uint8_t* pBytes = reinterpret_cast<const uint8_t*>(pValues);
+
+			for (size_t i = 0; i < count * sizeof(bool); ++i)
+			{
+				if (pBytes[i] > 1)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+
+	/// \note A corrupted type index would make a variant index its tables out of range, the current value is checked as well
+	template <typename... TArgs>
+	struct TSerializedValuesValidator<Variant<TArgs...>>
+	{
+		using TVariantType = Variant<TArgs...>;
+
+		static bool IsValid(const TVariantType* pValues, size_t count) VARIANT_NOEXCEPT
+		{
+			return _isValid(pValues, count, std::index_sequence_for<TArgs...>());
+		}
+
+		template <size_t Index>
+		static bool _isAlternativeValid(const TVariantType& value) VARIANT_NOEXCEPT
+		{
+			using TAlternative = typename TVariantAlternative<Index, TVariantType>::TType;
+			return TSerializedValuesValidator<TAlternative>::IsValid(&TVariantAccess::Get<Index>(value), 1);
+		}
+
+		template <size_t... Indices>
+		static bool _isValid(const TVariantType* pValues, size_t count, std::index_sequence<Indices...>) VARIANT_NOEXCEPT
+		{
+			static constexpr bool (*table[])(const TVariantType&) = { &_isAlternativeValid<Indices>... };
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const size_t typeIndex = pValues[i].GetTypeIndex();
+
+				if (typeIndex >= sizeof...(TArgs) || !table[typeIndex](pValues[i]))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	};
+
+
+	/*!
+		class BinaryWriter
+
+		\brief The writer appends values to the end of a given buffer
+	*/
+
+	class BinaryWriter final
+	{
+		public:
+			explicit BinaryWriter(std::vector<uint8_t>& buffer) VARIANT_NOEXCEPT : mBuffer(buffer) {}
+
+			template <typename T>
+			void Write(const T& value)
+			{
+				TSerializer<T>::Write(*this, value);
+			}
+
+			/// \brief The method writes the number of elements and then the elements themselves, trivially serializable ones are copied at once
+			template <typename T>
+			void WriteArray(const T* pData, size_t count)
+			{
+				assert(count <= (std::numeric_limits<uint32_t>::max)());
+
+				Write(static_cast<uint32_t>(count));
+				_writeArray(pData, count, std::integral_constant<bool, TIsTriviallySerializable<T>::value>());
+			}
+
+			void WriteBytes(const void* pData, size_t size)
+			{
+				const uint8_t* pBytes = static_cast<const uint8_t*>(pData);
+				mBuffer.insert(mBuffer.end(), pBytes, pBytes + size);
+			}
+
+			/// \brief The method pads the buffer with zeros until its size is a multiple of the alignment
+			void Align(size_t alignment)
+			{
+				mBuffer.resize((mBuffer.size() + alignment - 1) / alignment * alignment, 0);
+			}
+
+			size_t GetSize() const VARIANT_NOEXCEPT { return mBuffer.size(); }
+		private:
+			template <typename T>
+			void _writeArray(const T* pData, size_t count, std::true_type)
+			{
+				Align(alignof(T));
+				WriteBytes(pData, sizeof(T) * count);
+			}
+
+			template <typename T>
+			void _writeArray(const T* pData, size_t count, std::false_type)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					Write(pData[i]);
+				}
+			}
+		private:
+			std::vector<uint8_t>& mBuffer;
+	};
+
+
+	/*!
+		class BinaryReader
+
+		\brief The reader reads values from a buffer in the same order they were written. All offsets are counted
+		from the beginning of the buffer, so views are correctly aligned if the buffer itself is aligned for the
+		given type, which is the case for std::vector's data.
+	*/
+
+	class BinaryReader final
+	{
+		public:
+			BinaryReader(const void* pData, size_t size) VARIANT_NOEXCEPT : mpData(static_cast<const uint8_t*>(pData)), mSize(size), mOffset(0) {}
+			explicit BinaryReader(const std::vector<uint8_t>& buffer) VARIANT_NOEXCEPT : BinaryReader(buffer.data(), buffer.size()) {}
+
+			template <typename T>
+			bool Read(T& value)
+			{
+				return TSerializer<T>::Read(*this, value);
+			}
+
+			/*!
+				\brief The method returns a pointer to the given number of values within the buffer, nullptr is returned
+				if the buffer is too small, misaligned or contains invalid values. In the misaligned case the values could
+				be still read with Read().
+			*/
+
+			template <typename T>
+			const T* ReadView(size_t count = 1) VARIANT_NOEXCEPT
+			{
+				static_assert(TIsTriviallySerializable<T>::value, "[BinaryReader] Only trivially serializable values could be read without copying");
+
+				const size_t prevOffset = mOffset;
+
+				if (Align(alignof(T)) && !(reinterpret_cast<uintptr_t>(mpData + mOffset) % alignof(T)))
+				{
+					const uint8_t* pBytes = ReadBytes(sizeof(T) * count);
+					const T* pValues = reinterpret_cast<const T*>(pBytes);
+
+					if (pBytes && TSerializedValuesValidator<T>::IsValid(pValues, count))
+					{
+						return pValues;
+					}
+				}
+
+				mOffset = prevOffset;
+				return nullptr;
+			}
+
+			/// \brief The method reads an array that was written with BinaryWriter::WriteArray and returns a view of its elements
+			template <typename T>
+			const T* ReadArrayView(uint32_t& count) VARIANT_NOEXCEPT
+			{
+				const size_t prevOffset = mOffset;
+
+				if (!Read(count))
+				{
+					return nullptr;
+				}
+
+				if (const T* pElements = ReadView<T>(static_cast<size_t>(count)))
+				{
+					return pElements;
+				}
+
+				mOffset = prevOffset;
+				return nullptr;
+			}
+
+			/// \brief The method reads an array that was written with BinaryWriter::WriteArray into the vector
+			template <typename T>
+			bool ReadArray(std::vector<T>& elements)
+			{
+				uint32_t count = 0;
+
+				if (!Read(count) || !Align(TIsTriviallySerializable<T>::value ? alignof(T) : 1))
+				{
+					return false;
+				}
+
+				return _readArray(elements, count, std::integral_constant<bool, TIsTriviallySerializable<T>::value>());
+			}
+
+			/// \brief The method returns a pointer to the next bytes and skips them, nullptr is returned if there are not enough of them
+			const uint8_t* ReadBytes(size_t size) VARIANT_NOEXCEPT
+			{
+				if (size > mSize - mOffset)
+				{
+					return nullptr;
+				}
+
+				const uint8_t* pBytes = mpData + mOffset;
+				mOffset += size;
+
+				return pBytes;
+			}
+
+			bool Align(size_t alignment) VARIANT_NOEXCEPT
+			{
+				const size_t alignedOffset = (mOffset + alignment - 1) / alignment * alignment;
+
+				if (alignedOffset > mSize)
+				{
+					return false;
+				}
+
+				mOffset = alignedOffset;
+				return true;
+			}
+
+			size_t GetRemainingSize() const VARIANT_NOEXCEPT { return mSize - mOffset; }
+		private:
+			template <typename T>
+			bool _readArray(std::vector<T>& elements, uint32_t count, std::true_type)
+			{
+				const uint8_t* pBytes = ReadBytes(sizeof(T) * count);
+
+				if (!pBytes)
+				{
+					return false;
+				}
+
+				elements.resize(count);
+				memcpy(static_cast<void*>(elements.data()), pBytes, sizeof(T) * count);
+
+				/// \note Values are trivially copyable, so clearing invalid ones doesn't run any destructors' logic
+				if (!TSerializedValuesValidator<T>::IsValid(elements.data(), count))
+				{
+					elements.clear();
+					return false;
+				}
+
+				return true;
+			}
+
+			template <typename T>
+			bool _readArray(std::vector<T>& elements, uint32_t count, std::false_type)
+			{
+				/// \note The count isn't trusted, so the memory isn't reserved beforehand
+				elements.clear();
+
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					elements.emplace_back();
+
+					if (!Read(elements.back()))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+		private:
+			const uint8_t* mpData;
+			size_t         mSize;
+			size_t         mOffset;
+	};
+
+
+	template <typename T>
+	struct TSerializer<T, typename std::enable_if<std::is_trivially_copyable<T>::value>::type>
+	{
+		static void Write(BinaryWriter& writer, const T& value)
+		{
+			writer.Align(alignof(T));
+			writer.WriteBytes(&value, sizeof(T));
+		}
+
+		static bool Read(BinaryReader& reader, T& value)
+		{
+			const uint8_t* pBytes = reader.Align(alignof(T)) ? reader.ReadBytes(sizeof(T)) : nullptr;
+
+			if (!pBytes)
+			{
+				return false;
+			}
+
+			/// \note The buffer could be misaligned, so bytes are checked within an aligned copy that doesn't overwrite the value
+			alignas(T) uint8_t bytes[sizeof(T)];
+			memcpy(bytes, pBytes, sizeof(T));
+
+			if (!TSerializedValuesValidator<T>::IsValid(reinterpret_cast<const T*>(bytes), 1))
+			{
+				return false;
+			}
+
+			memcpy(&value, bytes, sizeof(T));
+			return true;
+		}
+	};
+
+
+	template <>
+	struct TSerializer<std::string>
+	{
+		static void Write(BinaryWriter& writer, const std::string& value)
+		{
+			writer.WriteArray(value.data(), value.size());
+		}
+
+		static bool Read(BinaryReader& reader, std::string& value)
+		{
+			uint32_t length = 0;
+
+			if (const char* pChars = reader.ReadArrayView<char>(length))
+			{
+				value.assign(pChars, length);
+				return true;
+			}
+
+			return false;
+		}
+	};
+
+
+	template <typename T>
+	struct TSerializer<std::vector<T>>
+	{
+		static void Write(BinaryWriter& writer, const std::vector<T>& elements) { writer.WriteArray(elements.data(), elements.size()); }
+		static bool Read(BinaryReader& reader, std::vector<T>& elements) { return reader.ReadArray(elements); }
+	};
+
+
+	/// \note A boxed value is written as the value itself, a value is read into an empty box after it's default constructed
+	template <typename T>
+	struct TSerializer<Boxed<T>>
+	{
+		static void Write(BinaryWriter& writer, const Boxed<T>& value) { writer.Write(value.Get()); }
+		static bool Read(BinaryReader& reader, Boxed<T>& value)
+		{
+			if (value.IsEmpty())
+			{
+				value = Boxed<T>();
+			}
+
+			return reader.Read(value.Get());
+		}
+	};
+
+
+	/*!
+		\brief A variant is written as its type index and the current value. Every alternative should be default
+		constructible, since a value is read into a default constructed one.
+	*/
+
+	template <typename... TArgs>
+	struct TSerializer<Variant<TArgs...>>
+	{
+		using TVariantType = Variant<TArgs...>;
+		using TTypeIndex = typename TVariantType::TTypeIndex;
+
+		static void Write(BinaryWriter& writer, const TVariantType& value)
+		{
+			writer.Write(value.GetTypeIndex());
+			Visit([&writer](const auto& currValue) { writer.Write(currValue); }, value);
+		}
+
+		static bool Read(BinaryReader& reader, TVariantType& value)
+		{
+			return _read(reader, value, std::index_sequence_for<TArgs...>());
+		}
+
+		template <size_t Index>
+		static bool _readAlternative(BinaryReader& reader, TVariantType& value)
+		{
+			return reader.Read(value.template Emplace<typename TVariantAlternative<Index, TVariantType>::TType>());
+		}
+
+		template <size_t... Indices>
+		static bool _read(BinaryReader& reader, TVariantType& value, std::index_sequence<Indices...>)
+		{
+			static constexpr bool (*table[])(BinaryReader&, TVariantType&) = { &_readAlternative<Indices>... };
+
+			TTypeIndex typeIndex = 0;
+
+			if (!reader.Read(typeIndex) || typeIndex >= sizeof...(TArgs))
+			{
+				return false;
+			}
+
+			return table[typeIndex](reader, value);
+		}
+	};
+
+
+	/// \note A result is written as a byte which is 1 for a value and 0 for an error, followed by the value or the error
+	template <typename T, typename E>
+	struct TSerializer<Result<T, E>>
+	{
+		static void Write(BinaryWriter& writer, const Result<T, E>& result)
+		{
+			writer.Write(static_cast<uint8_t>(result.IsOk()));
+
+			if (result.IsOk())
+			{
+				_writeValue(writer, result, std::is_void<T>());
+				return;
+			}
+
+			writer.Write(result.GetError());
+		}
+
+		static bool Read(BinaryReader& reader, Result<T, E>& result)
+		{
+			uint8_t isOk = 0;
+
+			if (!reader.Read(isOk) || isOk > 1)
+			{
+				return false;
+			}
+
+			if (isOk)
+			{
+				return _readValue(reader, result, std::is_void<T>());
+			}
+
+			E error {};
+
+			if (!reader.Read(error))
+			{
+				return false;
+			}
+
+			result = TErrValue<E>(std::move(error));
+			return true;
+		}
+
+		static void _writeValue(BinaryWriter& writer, const Result<T, E>& result, std::false_type) { writer.Write(result.Get()); }
+		static void _writeValue(BinaryWriter&, const Result<T, E>&, std::true_type) {}
+
+		template <typename U = T>
+		static bool _readValue(BinaryReader& reader, Result<U, E>& result, std::false_type)
+		{
+			U value {};
+
+			if (!reader.Read(value))
+			{
+				return false;
+			}
+
+			result = TOkValue<U>(std::move(value));
+			return true;
+		}
+
+		template <typename U = T>
+		static bool _readValue(BinaryReader&, Result<U, E>& result, std::true_type)
+		{
+			result = TOkValue<void>();
+			return true;
+		}
+	};
+}
@@ -15,12 +15,31 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
+#include <type_traits>
+#include <new>
+#include <tuple>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <functional>
+#include <exception>
 
 
 ///< Library's configs
 #define VARIANT_DISABLE_EXCEPTIONS 1
 #define VARIANT_ENABLE_EXPORT 1
 
+#if !defined(VARIANT_BOXING_SIZE_THRESHOLD)
+	#define VARIANT_BOXING_SIZE_THRESHOLD 64	///< TBoxedIfLarger<T> moves types of greater size into the heap
+#endif
+
+#if !defined(VARIANT_BOX_POOL_CAPACITY)
+	#define VARIANT_BOX_POOL_CAPACITY 64	///< The number of free blocks per each boxed type that a thread keeps for reuse
+#endif
+
 
 #if VARIANT_DISABLE_EXCEPTIONS
 #define VARIANT_NOEXCEPT noexcept
@@ -51,6 +70,24 @@ namespace Wrench
 	}
 
 
+	template <typename T> constexpr size_t GetMaxAlignment() { return alignof(T); }
+
+	template <typename T, typename... TArgs>
+	constexpr typename std::enable_if<TCountOf<TArgs...>::mValue != 0, size_t>::type GetMaxAlignment()
+	{
+		return alignof(T) > GetMaxAlignment<TArgs...>() ? alignof(T) : GetMaxAlignment<TArgs...>();
+	}
+
+
+	/// \note The smallest unsigned integer type which can index all the alternatives
+	template <size_t Count>
+	struct TVariantIndexType
+	{
+		using TType = typename std::conditional<(Count <= (std::numeric_limits<uint8_t>::max)()), uint8_t,
+						typename std::conditional<(Count <= (std::numeric_limits<uint16_t>::max)()), uint16_t, uint32_t>::type>::type;
+	};
+
+
 	template <size_t, typename>	constexpr size_t GetIndexOfTypeInternal() { return (std::numeric_limits<size_t>::max)(); } // nothing found
 
 	template <size_t index, typename TWhat, typename TCurrent, typename... TArgs>
@@ -62,89 +99,445 @@ namespace Wrench
 	template <typename TWhat, typename... TArgs> constexpr size_t GetIndexOfType() { return GetIndexOfTypeInternal<0, TWhat, TArgs...>(); }
 
 
+	template <typename... TArgs> struct TIsTriviallyCopyable;
+	template<> struct TIsTriviallyCopyable<> { static constexpr bool mValue = true; };
+	template <typename T, typename... TArgs> struct TIsTriviallyCopyable<T, TArgs...> { static constexpr bool mValue = std::is_trivially_copyable<T>::value && TIsTriviallyCopyable<TArgs...>::mValue; };
+
+
+	/// \note Values of such types are equal only if their bytes are equal, floating point types aren't the case because of NaNs and signed zeros
+	template <typename... TArgs> struct TIsBytewiseComparable;
+	template<> struct TIsBytewiseComparable<> { static constexpr bool mValue = true; };
+	template <typename T, typename... TArgs> struct TIsBytewiseComparable<T, TArgs...> 
+	{
+		static constexpr bool mValue = (std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value) && TIsBytewiseComparable<TArgs...>::mValue;
+	};
+
+
+	/*!
+		\brief The tables contain copy, move and destroy operations per each alternative, a variant calls one of them 
+		by its current type index. If all alternatives are trivially copyable, values are copied with memcpy
+		and nothing is destroyed.
+	*/
+
+	template <bool IsTriviallyCopyable, typename TStorageType, typename... TArgs>
+	struct TVariantLifecycle
+	{
+		static void Copy(size_t typeIndex, void* pDest, const void* pSrc) VARIANT_NOEXCEPT
+		{
+			static constexpr void (*table[])(void*, const void*) = { &_copy<TArgs>... };
+			table[typeIndex](pDest, pSrc);
+		}
+
+		static void Move(size_t typeIndex, void* pDest, void* pSrc) VARIANT_NOEXCEPT
+		{
+			static constexpr void (*table[])(void*, void*) = { &_move<TArgs>... };
+			table[typeIndex](pDest, pSrc);
+		}
+
+		static void Destroy(size_t typeIndex, void* pValue) VARIANT_NOEXCEPT
+		{
+			static constexpr void (*table[])(void*) = { &_destroy<TArgs>... };
+			table[typeIndex](pValue);
+		}
+
+		template <typename T> static void _copy(void* pDest, const void* pSrc) VARIANT_NOEXCEPT { new (pDest) T(*static_cast<const T*>(pSrc)); }
+		template <typename T> static void _move(void* pDest, void* pSrc) VARIANT_NOEXCEPT { new (pDest) T(std::move(*static_cast<T*>(pSrc))); }
+		template <typename T> static void _destroy(void* pValue) VARIANT_NOEXCEPT { static_cast<T*>(pValue)->~T(); }
+	};
+
+	template <typename TStorageType, typename... TArgs>
+	struct TVariantLifecycle<true, TStorageType, TArgs...>
+	{
+		static void Copy(size_t, void* pDest, const void* pSrc) VARIANT_NOEXCEPT { memcpy(pDest, pSrc, sizeof(TStorageType)); }
+		static void Move(size_t, void* pDest, void* pSrc) VARIANT_NOEXCEPT { memcpy(pDest, pSrc, sizeof(TStorageType)); }
+		static void Destroy(size_t, void*) VARIANT_NOEXCEPT {}
+	};
+
+
+	template <typename... TArgs> class Variant;
+
+
+	/// \brief The tag selects an alternative which is constructed in-place, e.g. Variant<int, TFoo> v(TInPlaceType<TFoo>(), arg0, arg1);
+	template <typename T> struct TInPlaceType {};
+
+	template <typename T> struct TIsInPlaceType : std::false_type {};
+	template <typename T> struct TIsInPlaceType<TInPlaceType<T>> : std::true_type {};
+
+
+	/*!
+		class BoxPool
+
+		\brief The pool keeps freed blocks of boxed values of type T in a thread local list, so a variant which
+		is reassigned again and again doesn't hit the global allocator. A block could be freed by any thread.
+
+		\note Once the pool of a thread is destroyed on its exit, blocks are allocated and freed with the global
+		allocator directly, so boxes destroyed by later thread_local or static destructors are still safe
+	*/
+
+	template <typename T>
+	class BoxPool final
+	{
+		public:
+			static void* Allocate()
+			{
+				BoxPool* pPool = _getInstance();
+
+				if (TFreeBlock* pBlock = pPool ? pPool->mpFreeList : nullptr)
+				{
+					pPool->mpFreeList = pBlock->mpNext;
+					--pPool->mFreeBlocksCount;
+
+					return pBlock;
+				}
+
+				return ::operator new(mBlockSize);
+			}
+
+			static void Deallocate(void* pBlock) VARIANT_NOEXCEPT
+			{
+				BoxPool* pPool = _getInstance();
+
+				if (!pPool || pPool->mFreeBlocksCount >= VARIANT_BOX_POOL_CAPACITY)
+				{
+					::operator delete(pBlock);
+					return;
+				}
+
+				pPool->mpFreeList = new (pBlock) TFreeBlock { pPool->mpFreeList };
+				++pPool->mFreeBlocksCount;
+			}
+		private:
+			struct TFreeBlock
+			{
+				TFreeBlock* mpNext;
+			};
+
+			enum class E_POOL_STATE : uint8_t
+			{
+				NOT_CREATED,
+				ALIVE,
+				DESTROYED,
+			};
+
+			static constexpr size_t mBlockSize = sizeof(T) > sizeof(TFreeBlock) ? sizeof(T) : sizeof(TFreeBlock);
+
+			BoxPool() VARIANT_NOEXCEPT
+			{
+				_getState() = E_POOL_STATE::ALIVE;
+			}
+
+			~BoxPool() VARIANT_NOEXCEPT
+			{
+				_getState() = E_POOL_STATE::DESTROYED;
+
+				while (TFreeBlock* pBlock = mpFreeList)
+				{
+					mpFreeList = pBlock->mpNext;
+					::operator delete(pBlock);
+				}
+			}
+
+			/// \note Returns nullptr when the pool of the calling thread has been already destroyed
+			static BoxPool* _getInstance() VARIANT_NOEXCEPT
+			{
+				if (_getState() == E_POOL_STATE::DESTROYED)
+				{
+					return nullptr;
+				}
+
+				static thread_local BoxPool pool;
+				return &pool;
+			}
+
+			/// \note The state is trivially destructible, so it outlives the pool and could be read during the thread's exit
+			static E_POOL_STATE& _getState() VARIANT_NOEXCEPT
+			{
+				static thread_local E_POOL_STATE state = E_POOL_STATE::NOT_CREATED;
+				return state;
+			}
+		private:
+			TFreeBlock* mpFreeList = nullptr;
+			size_t      mFreeBlocksCount = 0;
+	};
+
+
+	/*!
+		class Boxed
+
+		\brief The wrapper is a boxing marker for an alternative of a variant, e.g. Variant<int, Boxed<THugeStruct>>.
+		The value lives in a pooled heap block and the variant stores a pointer only, so a single huge alternative
+		doesn't inflate all the variants. Boxed<T> has value semantics, a copy copies the value.
+
+		\note A moved-from box is empty, it could be destroyed, copied or assigned but its value isn't accessible
+	*/
+
+	template <typename T>
+	class Boxed final
+	{
+		static_assert(alignof(T) <= alignof(std::max_align_t), "[Boxed] Over-aligned types aren't supported");
+
+		public:
+			Boxed() : Boxed(TInPlaceType<T>()) {}
+			Boxed(const T& value) : Boxed(TInPlaceType<T>(), value) {}
+			Boxed(T&& value) : Boxed(TInPlaceType<T>(), std::move(value)) {}
+
+			template <typename... TArgs>
+			explicit Boxed(TInPlaceType<T>, TArgs&&... args) :
+				mpValue(new (BoxPool<T>::Allocate()) T(std::forward<TArgs>(args)...))
+			{
+			}
+
+			Boxed(const Boxed& other) :
+				mpValue(other.mpValue ? new (BoxPool<T>::Allocate()) T(*other.mpValue) : nullptr)
+			{
+			}
+
+			Boxed(Boxed&& other) VARIANT_NOEXCEPT :
+				mpValue(other.mpValue)
+			{
+				other.mpValue = nullptr;
+			}
+
+			~Boxed() VARIANT_NOEXCEPT
+			{
+				_release();
+			}
+
+			Boxed& operator= (const Boxed& other)
+			{
+				if (this != &other)
+				{
+					*this = Boxed(other);
+				}
+
+				return *this;
+			}
+
+			Boxed& operator= (Boxed&& other) VARIANT_NOEXCEPT
+			{
+				if (this != &other)
+				{
+					_release();
+
+					mpValue = other.mpValue;
+					other.mpValue = nullptr;
+				}
+
+				return *this;
+			}
+
+			bool IsEmpty() const VARIANT_NOEXCEPT { return !mpValue; }
+
+			T& Get() VARIANT_NOEXCEPT { assert(mpValue); return *mpValue; }
+			const T& Get() const VARIANT_NOEXCEPT { assert(mpValue); return *mpValue; }
+
+			T& operator* () VARIANT_NOEXCEPT { return Get(); }
+			const T& operator* () const VARIANT_NOEXCEPT { return Get(); }
+
+			T* operator-> () VARIANT_NOEXCEPT { return &Get(); }
+			const T* operator-> () const VARIANT_NOEXCEPT { return &Get(); }
+
+			friend bool operator== (const Boxed& left, const Boxed& right) { return left.Get() == right.Get(); }
+			friend bool operator< (const Boxed& left, const Boxed& right) { return left.Get() < right.Get(); }
+		private:
+			void _release() VARIANT_NOEXCEPT
+			{
+				if (mpValue)
+				{
+					mpValue->~T();
+					BoxPool<T>::Deallocate(mpValue);
+				}
+			}
+		private:
+			T* mpValue;
+	};
+
+
+	/// \note The alias boxes T only if it's greater than VARIANT_BOXING_SIZE_THRESHOLD, e.g. Variant<int, TBoxedIfLarger<TMessage>>
+	template <typename T, size_t Threshold = VARIANT_BOXING_SIZE_THRESHOLD>
+	using TBoxedIfLarger = typename std::conditional<(sizeof(T) > Threshold), Boxed<T>, T>::type;
+
+	template <typename T> struct TVariantSize;
+	template <typename... TArgs> struct TVariantSize<Variant<TArgs...>> : std::integral_constant<size_t, sizeof...(TArgs)> {};
+
+	template <size_t Index, typename T> struct TVariantAlternative;
+	template <size_t Index, typename... TArgs> struct TVariantAlternative<Index, Variant<TArgs...>> { using TType = typename std::tuple_element<Index, std::tuple<TArgs...>>::type; };
+
+
+	/// \note The only place which knows how a variant stores its value, the type of the value isn't checked
+	struct TVariantAccess
+	{
+		template <typename TVariant>
+		static size_t GetTypeIndex(const TVariant& variant) VARIANT_NOEXCEPT { return variant.mCurrTypeId; }
+
+		template <size_t Index, typename TVariant>
+		static decltype(auto) Get(TVariant&& variant) VARIANT_NOEXCEPT
+		{
+			using TRawVariant = typename std::remove_reference<TVariant>::type;
+			using TAlternative = typename TVariantAlternative<Index, typename std::remove_const<TRawVariant>::type>::TType;
+			using TQualifiedAlternative = typename std::conditional<std::is_const<TRawVariant>::value, const TAlternative, TAlternative>::type;
+
+			return _forward<TVariant>(reinterpret_cast<TQualifiedAlternative&>(variant.mStorage));
+		}
+
+		template <typename TVariant, typename T>
+		static typename std::enable_if<std::is_lvalue_reference<TVariant>::value, T&>::type _forward(T& value) VARIANT_NOEXCEPT { return value; }
+
+		template <typename TVariant, typename T>
+		static typename std::enable_if<!std::is_lvalue_reference<TVariant>::value, T&&>::type _forward(T& value) VARIANT_NOEXCEPT { return std::move(value); }
+	};
+
+
 	/*!
 		class Variant
 
 		\brief An implementation of a sigma type which is also known as a tagged union or a variant
+
+		The storage is aligned for the most aligned alternative and the type index of the smallest sufficient
+		type is stored after it as a separate member, the variant is padded up to its alignment after the index,
+		e.g. Variant<int, float> takes 8 bytes and Variant<char, bool> takes 2 bytes.
 	*/
 
 	template <typename... TArgs>
 	class Variant
 	{
 		public:
-			using TStorageType = typename std::aligned_storage<GetMaxSize<TArgs...>()>::type;
-			using TTypeIndex = size_t;
+			using TStorageType = typename std::aligned_storage<GetMaxSize<TArgs...>(), GetMaxAlignment<TArgs...>()>::type;
+			using TTypeIndex = typename TVariantIndexType<TCountOf<TArgs...>::mValue>::TType;
+			using TLifecycle = TVariantLifecycle<TIsTriviallyCopyable<TArgs...>::mValue, TStorageType, TArgs...>;
 
 			friend void Swap(Variant<TArgs...>& v1, Variant<TArgs...>& v2)
 			{
-				std::swap(v1.mStorage, v2.mStorage);
-				std::swap(v1.mCurrTypeId, v2.mCurrTypeId);
+				Variant<TArgs...> temp(std::move(v1));
+
+				v1 = std::move(v2);
+				v2 = std::move(temp);
+			}
+
+			/// \note Variants are equal if they hold the same alternative with equal values
+			friend bool operator== (const Variant<TArgs...>& left, const Variant<TArgs...>& right) VARIANT_NOEXCEPT
+			{
+				return left.mCurrTypeId == right.mCurrTypeId && _isEqual(left, right, std::integral_constant<bool, TIsBytewiseComparable<TArgs...>::mValue>());
 			}
 
+			friend bool operator!= (const Variant<TArgs...>& left, const Variant<TArgs...>& right) VARIANT_NOEXCEPT { return !(left == right); }
+
+			/// \note Variants are ordered by their type indices first, then by their values
+			friend bool operator< (const Variant<TArgs...>& left, const Variant<TArgs...>& right) VARIANT_NOEXCEPT
+			{
+				if (left.mCurrTypeId != right.mCurrTypeId)
+				{
+					return left.mCurrTypeId < right.mCurrTypeId;
+				}
+
+				return Visit([&right](const auto& value) { return value < right.template As<typename std::decay<decltype(value)>::type>(); }, left);
+			}
+
+			friend bool operator> (const Variant<TArgs...>& left, const Variant<TArgs...>& right) VARIANT_NOEXCEPT { return right < left; }
+			friend bool operator<= (const Variant<TArgs...>& left, const Variant<TArgs...>& right) VARIANT_NOEXCEPT { return !(right < left); }
+			friend bool operator>= (const Variant<TArgs...>& left, const Variant<TArgs...>& right) VARIANT_NOEXCEPT { return !(left < right); }
+
 		public:
+			/// \note The variant holds a value-initialized first alternative
 			Variant() VARIANT_NOEXCEPT :
 				mStorage(), mCurrTypeId(0)
 			{
+				new (&mStorage) typename TVariantAlternative<0, Variant>::TType();
 			}
 
-			template <typename T>
-			Variant(T value) VARIANT_NOEXCEPT :
-				mStorage(), mCurrTypeId(0)
+			template <typename T, typename = typename std::enable_if<!std::is_same<typename std::decay<T>::type, Variant>::value &&
+																	 !TIsInPlaceType<typename std::decay<T>::type>::value>::type>
+			Variant(T&& value) VARIANT_NOEXCEPT :
+				mStorage(), mCurrTypeId(static_cast<TTypeIndex>(GetIndexOfType<typename std::decay<T>::type, TArgs...>()))
 			{
-				if (mCurrTypeId)
-				{
-					mStorage.~TStorageType();
-				}
+				using TAlternative = typename std::decay<T>::type;
+				static_assert(GetIndexOfType<TAlternative, TArgs...>() < sizeof...(TArgs), "[Variant] The type isn't an alternative of the variant");
 
-				mCurrTypeId = GetIndexOfType<T, TArgs...>();
+				new (&mStorage) TAlternative(std::forward<T>(value));
+			}
 
-				new (&mStorage) T(value);
+			template <typename T, typename... TCtorArgs>
+			explicit Variant(TInPlaceType<T>, TCtorArgs&&... args) VARIANT_NOEXCEPT :
+				mStorage(), mCurrTypeId(static_cast<TTypeIndex>(GetIndexOfType<T, TArgs...>()))
+			{
+				static_assert(GetIndexOfType<T, TArgs...>() < sizeof...(TArgs), "[Variant] The type isn't an alternative of the variant");
+
+				new (&mStorage) T(std::forward<TCtorArgs>(args)...);
 			}
 
 			Variant(const Variant& ref) VARIANT_NOEXCEPT :
-				mStorage(ref.mStorage), mCurrTypeId(ref.mCurrTypeId)
+				mCurrTypeId(ref.mCurrTypeId)
 			{
+				TLifecycle::Copy(mCurrTypeId, &mStorage, &ref.mStorage);
 			}
 
 			Variant(Variant&& ref) VARIANT_NOEXCEPT :
-				mStorage(std::move(ref.mStorage)), mCurrTypeId(ref.mCurrTypeId)
+				mCurrTypeId(ref.mCurrTypeId)
 			{
+				TLifecycle::Move(mCurrTypeId, &mStorage, &ref.mStorage);
 			}
 
 			~Variant() VARIANT_NOEXCEPT
 			{
-				mStorage.~TStorageType();
+				TLifecycle::Destroy(mCurrTypeId, &mStorage);
 			}
 
 			// Assignment operator
-			template <typename T>
-			const T& operator= (const T& value) VARIANT_NOEXCEPT
+			template <typename T, typename = typename std::enable_if<!std::is_same<typename std::decay<T>::type, Variant>::value>::type>
+			typename std::decay<T>::type& operator= (T&& value) VARIANT_NOEXCEPT
 			{
-				if (mCurrTypeId)
+				using TAlternative = typename std::decay<T>::type;
+
+				/// \note The value could be stored within the variant itself, so the same alternative is just assigned
+				if (Is<TAlternative>())
 				{
-					mStorage.~TStorageType();
+					return As<TAlternative>() = std::forward<T>(value);
 				}
 
-				mCurrTypeId = GetIndexOfType<T, TArgs...>();
+				return Emplace<TAlternative>(std::forward<T>(value));
+			}
+
+			/*!
+				\brief The method destroys current value and constructs a new one of type T in-place
+
+				\note Arguments shouldn't refer to the current value of the variant
+			*/
+
+			template <typename T, typename... TCtorArgs>
+			T& Emplace(TCtorArgs&&... args) VARIANT_NOEXCEPT
+			{
+				static_assert(GetIndexOfType<T, TArgs...>() < sizeof...(TArgs), "[Variant] The type isn't an alternative of the variant");
+
+				TLifecycle::Destroy(mCurrTypeId, &mStorage);
 
-				new (&mStorage) T(value);
+				mCurrTypeId = static_cast<TTypeIndex>(GetIndexOfType<T, TArgs...>());
 
-				return value;
+				return *new (&mStorage) T(std::forward<TCtorArgs>(args)...);
 			}
 
-			Variant<TArgs...>& operator= (Variant<TArgs...> value) VARIANT_NOEXCEPT
+			Variant<TArgs...>& operator= (const Variant<TArgs...>& value) VARIANT_NOEXCEPT
 			{
-				mStorage.~TStorageType();
+				if (this != &value)
+				{
+					TLifecycle::Destroy(mCurrTypeId, &mStorage);
+
+					mCurrTypeId = value.mCurrTypeId;
+					TLifecycle::Copy(mCurrTypeId, &mStorage, &value.mStorage);
+				}
 
-				Swap(*this, value);
 				return *this;
 			}
 
 			Variant<TArgs...>& operator= (Variant<TArgs...>&& value) VARIANT_NOEXCEPT
 			{
-				mStorage.~TStorageType();
+				if (this != &value)
+				{
+					TLifecycle::Destroy(mCurrTypeId, &mStorage);
+
+					mCurrTypeId = value.mCurrTypeId;
+					TLifecycle::Move(mCurrTypeId, &mStorage, &value.mStorage);
+				}
 
-				Swap(*this, value);
 				return *this;
 			}
 
@@ -177,16 +570,355 @@ namespace Wrench
 
 				return reinterpret_cast<T&>(mStorage);
 			}
+
+			TTypeIndex GetTypeIndex() const VARIANT_NOEXCEPT { return mCurrTypeId; }
+		private:
+			friend struct TVariantAccess;
+
+			/// \note Type indices are already known to be equal, only bytes of the current alternative are compared
+			static bool _isEqual(const Variant& left, const Variant& right, std::true_type) VARIANT_NOEXCEPT
+			{
+				static constexpr size_t sizes[] = { sizeof(TArgs)... };
+				return !memcmp(&left.mStorage, &right.mStorage, sizes[left.mCurrTypeId]);
+			}
+
+			static bool _isEqual(const Variant& left, const Variant& right, std::false_type) VARIANT_NOEXCEPT
+			{
+				return Visit([&right](const auto& value) { return value == right.template As<typename std::decay<decltype(value)>::type>(); }, left);
+			}
 		private:
 			TStorageType mStorage;
 			TTypeIndex mCurrTypeId = 0x0;
 	};
 
 
+	/*!
+		\brief The table contains an invoker per each combination of the variants' alternatives. A combination's
+		index is built like a number whose digits are type indices of the variants, so a visitation is a single
+		indirect call through the table.
+	*/
+
+	template <typename TVisitor, typename... TVariants>
+	struct TVariantVisitTable
+	{
+		using TResult = decltype(std::declval<TVisitor>()(TVariantAccess::Get<0>(std::declval<TVariants>())...));
+		using TInvoker = TResult (*)(TVisitor, TVariants...);
+
+		template <size_t... Sizes>
+		static constexpr size_t GetAlternativeIndex(size_t flatIndex, size_t variantIndex)
+		{
+			const size_t sizes[] = { Sizes... };
+
+			size_t stride = 1;
+
+			for (size_t i = variantIndex + 1; i < sizeof...(Sizes); ++i)
+			{
+				stride *= sizes[i];
+			}
+
+			return (flatIndex / stride) % sizes[variantIndex];
+		}
+
+		template <size_t FlatIndex, size_t... VariantIndices>
+		static TResult _invoke(TVisitor visitor, TVariants... variants)
+		{
+			return std::forward<TVisitor>(visitor)(TVariantAccess::Get<
+				GetAlternativeIndex<TVariantSize<typename std::decay<TVariants>::type>::value...>(FlatIndex, VariantIndices)>(std::forward<TVariants>(variants))...);
+		}
+
+		template <size_t... FlatIndices, size_t... VariantIndices>
+		static TResult Invoke(std::index_sequence<FlatIndices...>, std::index_sequence<VariantIndices...>, TVisitor visitor, TVariants... variants)
+		{
+			static constexpr TInvoker table[] = { &_invoke<FlatIndices, VariantIndices...>... };
+
+			const size_t sizes[] = { TVariantSize<typename std::decay<TVariants>::type>::value... };
+			const size_t typeIndices[] = { TVariantAccess::GetTypeIndex(variants)... };
+
+			size_t flatIndex = 0;
+
+			for (size_t i = 0; i < sizeof...(TVariants); ++i)
+			{
+				assert(typeIndices[i] < sizes[i]);
+				flatIndex = flatIndex * sizes[i] + typeIndices[i];
+			}
+
+			return table[flatIndex](std::forward<TVisitor>(visitor), std::forward<TVariants>(variants)...);
+		}
+	};
+
+
+	template <size_t... Sizes> struct TProductOf;
+	template <> struct TProductOf<> { static constexpr size_t mValue = 1; };
+	template <size_t Size, size_t... Sizes> struct TProductOf<Size, Sizes...> { static constexpr size_t mValue = Size * TProductOf<Sizes...>::mValue; };
+
+
+	/*!
+		\brief The function invokes the visitor with current values of all given variants, e.g.
+
+		Visit([](const auto& value) { ... }, v);
+		Visit([](const auto& left, const auto& right) { ... }, v1, v2);
+
+		The visitor should return the same type for all combinations of alternatives.
+	*/
+
+	template <typename TVisitor, typename... TVariants>
+	decltype(auto) Visit(TVisitor&& visitor, TVariants&&... variants)
+	{
+		static_assert(sizeof...(TVariants) > 0, "[Visit] At least one variant should be passed");
+
+		using TTable = TVariantVisitTable<TVisitor&&, TVariants&&...>;
+
+		return TTable::Invoke(std::make_index_sequence<TProductOf<TVariantSize<typename std::decay<TVariants>::type>::value...>::mValue>(),
+			std::index_sequence_for<TVariants...>(), std::forward<TVisitor>(visitor), std::forward<TVariants>(variants)...);
+	}
+
+
 	template <typename T, typename... TArgs> 
 	Variant<TArgs...> MakeVariant(T value)
 	{
-		Variant<TArgs...> v; v = std::forward<T>(value);
-		return std::move(v);
+		return Variant<TArgs...>(std::move(value));
 	}
+
+
+	/*!
+		class VariantVector
+
+		\brief The container stores variants' values in a separate contiguous array per each alternative. The order
+		of insertion is kept by a compact table of (type index, index within the array) pairs. Passes over a single
+		alternative are sequential with GetValues<T>() or ForEach<T>(), Visit() traverses all values in insertion
+		order and VisitByType() traverses them array by array, e.g.
+
+		VariantVector<int, float> values;
+		values.PushBack(1);
+		values.PushBack(2.0f);
+
+		values.ForEach<float>([](float& value) { ... });
+		values.Visit([](const auto& value) { ... });
+	*/
+
+	template <typename... TArgs>
+	class VariantVector
+	{
+		public:
+			using TVariantType = Variant<TArgs...>;
+			using TTypeIndex = typename TVariantType::TTypeIndex;
+
+			struct TElementLocation
+			{
+				TTypeIndex mTypeIndex;
+				uint32_t   mIndex;
+			};
+
+			template <typename T> using TValuesArray = std::vector<T>;
+		public:
+			template <typename T, typename = typename std::enable_if<!std::is_same<typename std::decay<T>::type, TVariantType>::value>::type>
+			void PushBack(T&& value)
+			{
+				EmplaceBack<typename std::decay<T>::type>(std::forward<T>(value));
+			}
+
+			template <typename T, typename... TCtorArgs>
+			T& EmplaceBack(TCtorArgs&&... args)
+			{
+				constexpr size_t typeIndex = GetIndexOfType<T, TArgs...>();
+				static_assert(typeIndex < sizeof...(TArgs), "[VariantVector] The type isn't an alternative of the variant");
+
+				auto& values = std::get<typeIndex>(mValues);
+
+				assert(values.size() < (std::numeric_limits<uint32_t>::max)());
+
+				mLocations.push_back({ static_cast<TTypeIndex>(typeIndex), static_cast<uint32_t>(values.size()) });
+				values.emplace_back(std::forward<TCtorArgs>(args)...);
+
+				return values.back();
+			}
+
+			void PushBack(const TVariantType& value)
+			{
+				Wrench::Visit([this](const auto& currValue) { PushBack(currValue); }, value);
+			}
+
+			void PushBack(TVariantType&& value)
+			{
+				Wrench::Visit([this](auto&& currValue) { PushBack(std::move(currValue)); }, std::move(value));
+			}
+
+			void Reserve(size_t capacity)
+			{
+				mLocations.reserve(capacity);
+			}
+
+			template <typename T>
+			void Reserve(size_t capacity)
+			{
+				_getValues<T>().reserve(capacity);
+			}
+
+			void Clear() VARIANT_NOEXCEPT
+			{
+				mLocations.clear();
+				_clear(std::index_sequence_for<TArgs...>());
+			}
+
+			/// \brief The method invokes the visitor with each value in insertion order
+			template <typename TVisitor>
+			void Visit(TVisitor&& visitor)
+			{
+				_visit(*this, visitor, std::index_sequence_for<TArgs...>());
+			}
+
+			template <typename TVisitor>
+			void Visit(TVisitor&& visitor) const
+			{
+				_visit(*this, visitor, std::index_sequence_for<TArgs...>());
+			}
+
+			/// \brief The method invokes the visitor with all values of the first alternative, then with the second's ones and so on
+			template <typename TVisitor>
+			void VisitByType(TVisitor&& visitor)
+			{
+				_visitByType(*this, visitor, std::index_sequence_for<TArgs...>());
+			}
+
+			template <typename TVisitor>
+			void VisitByType(TVisitor&& visitor) const
+			{
+				_visitByType(*this, visitor, std::index_sequence_for<TArgs...>());
+			}
+
+			template <typename T, typename TAction>
+			void ForEach(TAction&& action)
+			{
+				for (auto&& currValue : _getValues<T>())
+				{
+					action(currValue);
+				}
+			}
+
+			template <typename T, typename TAction>
+			void ForEach(TAction&& action) const
+			{
+				for (auto&& currValue : GetValues<T>())
+				{
+					action(currValue);
+				}
+			}
+
+			template <typename T>
+			const TValuesArray<T>& GetValues() const VARIANT_NOEXCEPT
+			{
+				return std::get<GetIndexOfType<T, TArgs...>()>(mValues);
+			}
+
+			template <typename T>
+			bool Is(size_t index) const VARIANT_NOEXCEPT
+			{
+				return mLocations[index].mTypeIndex == GetIndexOfType<T, TArgs...>();
+			}
+
+			template <typename T>
+			const T& As(size_t index) const VARIANT_NOEXCEPT
+			{
+				if (!Is<T>(index))
+				{
+					assert(false);
+					std::terminate();
+				}
+
+				return GetValues<T>()[mLocations[index].mIndex];
+			}
+
+			template <typename T>
+			T& As(size_t index) VARIANT_NOEXCEPT
+			{
+				if (!Is<T>(index))
+				{
+					assert(false);
+					std::terminate();
+				}
+
+				return _getValues<T>()[mLocations[index].mIndex];
+			}
+
+			TTypeIndex GetTypeIndex(size_t index) const VARIANT_NOEXCEPT { return mLocations[index].mTypeIndex; }
+
+			size_t GetSize() const VARIANT_NOEXCEPT { return mLocations.size(); }
+			bool IsEmpty() const VARIANT_NOEXCEPT { return mLocations.empty(); }
+
+			template <typename T>
+			size_t GetSize() const VARIANT_NOEXCEPT { return GetValues<T>().size(); }
+		private:
+			template <typename T>
+			TValuesArray<T>& _getValues() VARIANT_NOEXCEPT
+			{
+				return std::get<GetIndexOfType<T, TArgs...>()>(mValues);
+			}
+
+			template <size_t... Indices>
+			void _clear(std::index_sequence<Indices...>) VARIANT_NOEXCEPT
+			{
+				const int dummy[] = { 0, (std::get<Indices>(mValues).clear(), 0)... };
+				(void)dummy;
+			}
+
+			template <size_t Index, typename TSelf, typename TVisitor>
+			static void _visitValue(TSelf& self, TVisitor& visitor, uint32_t index)
+			{
+				visitor(std::get<Index>(self.mValues)[index]);
+			}
+
+			template <typename TSelf, typename TVisitor, size_t... Indices>
+			static void _visit(TSelf& self, TVisitor& visitor, std::index_sequence<Indices...>)
+			{
+				static constexpr void (*table[])(TSelf&, TVisitor&, uint32_t) = { &_visitValue<Indices, TSelf, TVisitor>... };
+
+				for (const TElementLocation& currLocation : self.mLocations)
+				{
+					table[currLocation.mTypeIndex](self, visitor, currLocation.mIndex);
+				}
+			}
+
+			template <typename TSelf, typename TVisitor, size_t... Indices>
+			static void _visitByType(TSelf& self, TVisitor& visitor, std::index_sequence<Indices...>)
+			{
+				const int dummy[] = { 0, (_visitValues(std::get<Indices>(self.mValues), visitor), 0)... };
+				(void)dummy;
+			}
+
+			template <typename TValues, typename TVisitor>
+			static void _visitValues(TValues& values, TVisitor& visitor)
+			{
+				for (auto&& currValue : values)
+				{
+					visitor(currValue);
+				}
+			}
+		private:
+			std::tuple<TValuesArray<TArgs>...> mValues;
+			std::vector<TElementLocation>      mLocations;
+	};
+}
+
+
+namespace std
+{
+	/// \note A hash of a variant combines its type index with the hash of its current value
+	template <typename... TArgs>
+	struct hash<Wrench::Variant<TArgs...>>
+	{
+		size_t operator()(const Wrench::Variant<TArgs...>& value) const VARIANT_NOEXCEPT
+		{
+			const size_t valueHash = Wrench::Visit([](const auto& currValue) { return std::hash<typename std::decay<decltype(currValue)>::type>()(currValue); }, value);
+			const size_t typeIndex = static_cast<size_t>(value.GetTypeIndex());
+
+			return valueHash ^ (typeIndex + 0x9e3779b9 + (valueHash << 6) + (valueHash >> 2));
+		}
+	};
+
+
+	template <typename T>
+	struct hash<Wrench::Boxed<T>>
+	{
+		size_t operator()(const Wrench::Boxed<T>& value) const VARIANT_NOEXCEPT { return std::hash<T>()(value.Get()); }
+	};
 }
\ No newline at end of file
@@ -1,6 +1,10 @@
 #include <catch2/catch.hpp>
 #define DELEGATE_IMPLEMENTATION
 #include "delegate.hpp"
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <string>
 
 
 using namespace Wrench;
@@ -94,4 +98,869 @@ TEST_CASE("Test Delegate")
 
 		REQUIRE(!hasLambdaBeenExecuted); /// \note The given lambda should not be invoked later
 	}
-}
\ No newline at end of file
+
+	SECTION("TestSubscribe_PassObjectAndMethod_InvokesTheMethod")
+	{
+		struct Foo
+		{
+			void Bar(float value) { mSum += value; }
+
+			float mSum = 0.0f;
+		};
+
+		Foo testFooObject;
+
+		Delegate<float> testDelegate;
+		testDelegate.Subscribe(&testFooObject, &Foo::Bar);
+		testDelegate.Subscribe<Foo, &Foo::Bar>(&testFooObject);
+
+		testDelegate.Notify(1.0f);
+
+		REQUIRE(testFooObject.mSum == 2.0f);
+	}
+
+	SECTION("TestSubscribe_PassMoveOnlyLambda_InvokesItAndDestroysCapturesOnUnsubscribe")
+	{
+		auto pValue = std::make_shared<int>(0);
+		std::weak_ptr<int> pWeakValue = pValue;
+
+		Delegate<int> testDelegate;
+
+		auto handle = testDelegate.Subscribe([pOwnedValue = std::make_unique<std::shared_ptr<int>>(std::move(pValue))](int value)
+		{
+			**pOwnedValue = value;
+		});
+
+		testDelegate.Notify(42);
+
+		REQUIRE(*pWeakValue.lock() == 42);
+
+		REQUIRE(testDelegate.Unsubscribe(handle));
+		REQUIRE(pWeakValue.expired());
+	}
+
+	SECTION("TestUnsubscribe_PassStaleHandleOfReusedSlot_DoesNotAffectNewListener")
+	{
+		uint32_t callsCount = 0;
+
+		Delegate<float> testDelegate;
+
+		auto staleHandle = testDelegate.Subscribe([](float) {});
+		REQUIRE(testDelegate.Unsubscribe(staleHandle));
+
+		auto newHandle = testDelegate.Subscribe([&callsCount](float) { ++callsCount; });
+		REQUIRE(newHandle != staleHandle);
+
+		REQUIRE(!testDelegate.Unsubscribe(staleHandle));
+
+		testDelegate.Notify(0.0f);
+		REQUIRE(callsCount == 1);
+	}
+
+	SECTION("TestUnsubscribe_UnsubscribeMostOfListeners_RemainingOnesAreInvokedAndOldHandlesStayInvalid")
+	{
+		constexpr uint32_t listenersCount = 1000;
+
+		uint32_t callsCount = 0;
+
+		Delegate<float> testDelegate;
+
+		std::vector<TSubscriptionHandle> handles;
+
+		for (uint32_t i = 0; i < listenersCount; ++i)
+		{
+			handles.push_back(testDelegate.Subscribe([&callsCount](float) { ++callsCount; }));
+		}
+
+		for (uint32_t i = 1; i < listenersCount; ++i)
+		{
+			REQUIRE(testDelegate.Unsubscribe(handles[i]));
+		}
+
+		for (uint32_t i = 1; i < listenersCount; ++i)
+		{
+			testDelegate.Subscribe([](float) {});
+			REQUIRE(!testDelegate.Unsubscribe(handles[i]));
+		}
+
+		testDelegate.Notify(0.0f);
+		REQUIRE(callsCount == 1);
+
+		REQUIRE(testDelegate.Unsubscribe(handles[0]));
+	}
+
+	SECTION("TestReserve_ReserveAfterSubscription_ListenersAreKeptAndNewOnesAreInvoked")
+	{
+		const int listenersCount = 64;
+
+		Delegate<int> testDelegate;
+
+		int sum = 0;
+		testDelegate.Subscribe([&sum](int value) { sum += value; });
+
+		testDelegate.Reserve(listenersCount);
+
+		std::vector<TSubscriptionHandle> handles;
+
+		for (int i = 1; i < listenersCount; ++i)
+		{
+			handles.push_back(testDelegate.Subscribe([&sum](int value) { sum += value; }));
+		}
+
+		testDelegate.Notify(1);
+		REQUIRE(sum == listenersCount);
+
+		for (TSubscriptionHandle currHandle : handles)
+		{
+			REQUIRE(testDelegate.Unsubscribe(currHandle));
+		}
+
+		testDelegate.Notify(1);
+		REQUIRE(sum == listenersCount + 1);
+	}
+
+	SECTION("TestNotifyBatch_PassFewEvents_BatchListenerReceivesThemAtOnceAndRegularOneOneByOne")
+	{
+		const std::vector<float> events { 1.0f, 2.0f, 3.0f };
+
+		std::vector<size_t> batchSizes;
+		float batchSum = 0.0f;
+		float regularSum = 0.0f;
+
+		Delegate<float> testDelegate;
+
+		testDelegate.SubscribeBatch([&](TSpan<float> values)
+		{
+			batchSizes.push_back(values.GetSize());
+
+			for (float currValue : values)
+			{
+				batchSum += currValue;
+			}
+		});
+
+		testDelegate.Subscribe([&regularSum](float value) { regularSum += value; });
+
+		testDelegate.NotifyBatch(events);
+		testDelegate.Notify(4.0f);
+
+		REQUIRE(batchSizes == std::vector<size_t> { 3, 1 });
+		REQUIRE(batchSum == 10.0f);
+		REQUIRE(regularSum == 10.0f);
+	}
+
+	SECTION("TestNotifyBatch_PassEventsOfFewArguments_ListenersReceiveTuples")
+	{
+		using TTestDelegate = Delegate<int, std::string>;
+
+		const std::vector<TTestDelegate::TEvent> events { std::make_tuple(1, std::string("a")), std::make_tuple(2, std::string("b")) };
+
+		std::string concatenatedStr;
+		int batchSum = 0;
+
+		TTestDelegate testDelegate;
+
+		testDelegate.Subscribe([&concatenatedStr](int, std::string str) { concatenatedStr += str; });
+		testDelegate.SubscribeBatch([&batchSum](TSpan<TTestDelegate::TEvent> events)
+		{
+			for (auto&& currEvent : events)
+			{
+				batchSum += std::get<0>(currEvent);
+			}
+		});
+
+		testDelegate.NotifyBatch(events);
+
+		REQUIRE(concatenatedStr == "ab");
+		REQUIRE(batchSum == 3);
+	}
+
+	SECTION("TestSubscribe_PassListenersWithDifferentPriorities_InvokesThemInDescendingOrder")
+	{
+		std::string callsOrder;
+
+		Delegate<> testDelegate;
+
+		testDelegate.Subscribe([&callsOrder] { callsOrder += "c"; }, -1);
+		testDelegate.Subscribe([&callsOrder] { callsOrder += "a"; }, 10);
+		testDelegate.Subscribe([&callsOrder] { callsOrder += "b"; });
+		testDelegate.Subscribe([&callsOrder] { callsOrder += "B"; });
+
+		testDelegate.Notify();
+
+		REQUIRE(callsOrder == "abBc");
+	}
+
+	SECTION("TestNotify_CancellableListenerReturnsTrue_StopsPropagationToLowerPriorityListeners")
+	{
+		int lowPriorityCallsCount = 0;
+		bool shouldCancel = true;
+
+		Delegate<int> testDelegate;
+
+		testDelegate.Subscribe([&lowPriorityCallsCount](int) { ++lowPriorityCallsCount; });
+		testDelegate.SubscribeCancellable([&shouldCancel](int) { return shouldCancel; }, 1);
+
+		REQUIRE(testDelegate.Notify(42));
+		REQUIRE(lowPriorityCallsCount == 0);
+
+		shouldCancel = false;
+
+		REQUIRE(!testDelegate.Notify(42));
+		REQUIRE(lowPriorityCallsCount == 1);
+	}
+}
+
+TEST_CASE("Test Delegate's combiners")
+{
+	using TTestDelegate = Delegate<int(int)>;
+
+	TTestDelegate testDelegate;
+
+	testDelegate.Subscribe([](int value) { return value; });
+	testDelegate.Subscribe([](int value) { return value * 3; }, 1);
+	testDelegate.Subscribe([](int value) { return value * 2; });
+
+	SECTION("TestNotify_PassCollectCombiner_WritesResultsIntoBufferInOrderOfPriorities")
+	{
+		int results[4] = { 0 };
+
+		REQUIRE(testDelegate.Notify(CollectCombiner<int>(results, 4), 2) == 3);
+		REQUIRE(results[0] == 6);
+		REQUIRE(results[1] == 2);
+		REQUIRE(results[2] == 4);
+	}
+
+	SECTION("TestNotify_PassCollectCombinerWithSmallBuffer_StopsWhenBufferIsFull")
+	{
+		int results[2] = { 0 };
+
+		REQUIRE(testDelegate.Notify(CollectCombiner<int>(results, 2), 2) == 2);
+		REQUIRE(results[0] == 6);
+		REQUIRE(results[1] == 2);
+	}
+
+	SECTION("TestNotify_PassArithmeticCombiners_ReturnsAggregatedValues")
+	{
+		REQUIRE(testDelegate.Notify(SumCombiner<int>(), 2) == 12);
+		REQUIRE(testDelegate.Notify(MinCombiner<int>(), 2) == 2);
+		REQUIRE(testDelegate.Notify(MaxCombiner<int>(), 2) == 6);
+	}
+
+	SECTION("TestNotify_PassFirstNonEmptyCombiner_StopsOnFirstNonEmptyResult")
+	{
+		int value = 42;
+		int callsCount = 0;
+
+		Delegate<int*()> pointersDelegate;
+
+		pointersDelegate.Subscribe([&callsCount]() -> int* { ++callsCount; return nullptr; });
+		pointersDelegate.Subscribe([&callsCount, &value] { ++callsCount; return &value; });
+		pointersDelegate.Subscribe([&callsCount, &value] { ++callsCount; return &value; });
+
+		REQUIRE(pointersDelegate.Notify(FirstNonEmptyCombiner<int*>()) == &value);
+		REQUIRE(callsCount == 2);
+	}
+
+	SECTION("TestNotify_PassAllTrueCombiner_ReturnsFalseIfSomeListenerDisagrees")
+	{
+		Delegate<bool(int)> predicatesDelegate;
+
+		REQUIRE(predicatesDelegate.Notify(AllTrueCombiner(), 1));
+
+		predicatesDelegate.Subscribe([](int value) { return value > 0; });
+		predicatesDelegate.Subscribe([](int value) { return value < 10; });
+
+		REQUIRE(predicatesDelegate.Notify(AllTrueCombiner(), 1));
+		REQUIRE(!predicatesDelegate.Notify(AllTrueCombiner(), 11));
+	}
+}
+
+#if DELEGATE_ENABLE_PROFILING
+
+TEST_CASE("Test Delegate's profiling")
+{
+	SECTION("TestNotify_ProfilingIsEnabled_CollectsStatsPerListener")
+	{
+		Delegate<int> testDelegate;
+
+		const auto firstHandle = testDelegate.Subscribe([](int) {});
+		const auto secondHandle = testDelegate.Subscribe([](int) { std::this_thread::sleep_for(std::chrono::milliseconds(1)); });
+
+		testDelegate.Notify(1);
+		testDelegate.Notify(2);
+
+		const TDelegateListenerStats firstStats = testDelegate.GetListenerStats(firstHandle);
+		const TDelegateListenerStats secondStats = testDelegate.GetListenerStats(secondHandle);
+
+		REQUIRE(firstStats.mCallsCount == 2);
+		REQUIRE(secondStats.mCallsCount == 2);
+		REQUIRE(secondStats.mMaxCycles <= secondStats.mTotalCycles);
+		REQUIRE(secondStats.mTotalCycles > firstStats.mTotalCycles);
+
+		testDelegate.Unsubscribe(firstHandle);
+		REQUIRE(testDelegate.GetListenerStats(firstHandle).mCallsCount == 0);
+	}
+
+	SECTION("TestNotify_ListenerExceedsThreshold_SlowListenerCallbackReceivesItsHandle")
+	{
+		Delegate<> testDelegate;
+
+		std::vector<TSubscriptionHandle> slowListeners;
+
+		testDelegate.Subscribe([] {});
+		const auto slowHandle = testDelegate.Subscribe([] { std::this_thread::sleep_for(std::chrono::milliseconds(20)); });
+
+		testDelegate.SetSlowListenerCallback(1000000, [&slowListeners](TSubscriptionHandle handle, uint64_t)
+		{
+			slowListeners.push_back(handle);
+		});
+
+		testDelegate.Notify();
+
+		REQUIRE(slowListeners == std::vector<TSubscriptionHandle> { slowHandle });
+	}
+}
+
+#endif
+
+namespace
+{
+	int StaticListenerCallsCount = 0;
+
+	void IncrementStaticListenerCallsCount(int value)
+	{
+		StaticListenerCallsCount += value;
+	}
+
+	bool IsNegativeValue(int value)
+	{
+		return value < 0;
+	}
+}
+
+TEST_CASE("Test StaticDelegate")
+{
+	SECTION("TestNotify_PassListenersAsTypeList_InvokesThemInOrder")
+	{
+		StaticListenerCallsCount = 0;
+
+		StaticDelegate<TStaticFunctionBinding<void(int), &IncrementStaticListenerCallsCount>,
+					   TStaticFunctionBinding<void(int), &IncrementStaticListenerCallsCount>> testDelegate;
+
+		REQUIRE(!testDelegate.Notify(2));
+		REQUIRE(StaticListenerCallsCount == 4);
+		REQUIRE(testDelegate.GetListenersCount() == 2);
+	}
+
+	SECTION("TestNotify_CreateDelegateFromLambdas_InvokesThemAndStopsOnCancellation")
+	{
+		StaticListenerCallsCount = 0;
+
+		std::string callsOrder;
+
+		auto testDelegate = MakeStaticDelegate(
+			[&callsOrder](int) { callsOrder += "a"; },
+			TStaticFunctionBinding<bool(int), &IsNegativeValue>(),
+			[&callsOrder](int value) { callsOrder += "b"; IncrementStaticListenerCallsCount(value); });
+
+		REQUIRE(!testDelegate(1));
+		REQUIRE(callsOrder == "ab");
+
+		REQUIRE(testDelegate(-1));
+		REQUIRE(callsOrder == "aba");
+		REQUIRE(StaticListenerCallsCount == 1);
+	}
+
+	SECTION("TestNotify_EmptyStaticDelegate_DoesNothing")
+	{
+		StaticDelegate<> testDelegate;
+		REQUIRE(!testDelegate.Notify(42));
+	}
+}
+
+TEST_CASE("Test Delegate's weak listeners")
+{
+	struct TOwner
+	{
+		void OnEvent(int value) { mSum += value; }
+
+		int mSum = 0;
+	};
+
+	SECTION("TestSubscribeWeak_OwnerIsDestroyed_ListenerIsNotInvokedAndPrunedLater")
+	{
+		Delegate<int> testDelegate;
+
+		auto pOwner = std::make_shared<TOwner>();
+		auto pCapturedResource = std::make_shared<int>(0);
+
+		testDelegate.SubscribeWeak(std::weak_ptr<TOwner>(pOwner), [pOwnerRaw = pOwner.get(), pCapturedResource](int value) { pOwnerRaw->OnEvent(value); });
+		testDelegate.SubscribeWeak(std::weak_ptr<TOwner>(pOwner), &TOwner::OnEvent);
+
+		testDelegate.Notify(2);
+		REQUIRE(pOwner->mSum == 4);
+
+		pOwner.reset();
+
+		for (int i = 0; i < DELEGATE_EXPIRED_LISTENERS_PRUNE_THRESHOLD; ++i)
+		{
+			testDelegate.Notify(1);
+		}
+
+		REQUIRE(pCapturedResource.use_count() == 1);
+		REQUIRE(testDelegate.PruneExpiredListeners() == 0);
+	}
+
+	SECTION("TestPruneExpiredListeners_SomeOwnersAreDead_RemovesOnlyTheirListeners")
+	{
+		Delegate<int> testDelegate;
+
+		std::vector<std::shared_ptr<TOwner>> owners;
+
+		for (int i = 0; i < 10; ++i)
+		{
+			owners.push_back(std::make_shared<TOwner>());
+			testDelegate.SubscribeWeak(std::weak_ptr<TOwner>(owners.back()), &TOwner::OnEvent);
+		}
+
+		for (size_t i = 0; i < owners.size(); i += 2)
+		{
+			owners[i].reset();
+		}
+
+		REQUIRE(testDelegate.PruneExpiredListeners() == 5);
+
+		testDelegate.Notify(1);
+
+		for (size_t i = 1; i < owners.size(); i += 2)
+		{
+			REQUIRE(owners[i]->mSum == 1);
+		}
+	}
+
+	SECTION("TestSubscribeScoped_ConnectionIsDestroyed_ListenerIsUnsubscribed")
+	{
+		Delegate<int> testDelegate;
+
+		int callsCount = 0;
+
+		{
+			ScopedConnection connection = testDelegate.SubscribeScoped([&callsCount](int) { ++callsCount; });
+			REQUIRE(connection.IsConnected());
+
+			testDelegate.Notify(1);
+
+			ScopedConnection movedConnection = std::move(connection);
+			REQUIRE(!connection.IsConnected());
+
+			testDelegate.Notify(1);
+		}
+
+		testDelegate.Notify(1);
+		REQUIRE(callsCount == 2);
+	}
+}
+
+TEST_CASE("Test Delegate's reentrancy")
+{
+	SECTION("TestNotify_PruneExpiredListenersAndUnsubscribeFromListener_BothAreApplied")
+	{
+		Delegate<> testDelegate;
+
+		auto pOwner = std::make_shared<int>(0);
+		int weakListenerCallsCount = 0;
+		int lastListenerCallsCount = 0;
+
+		size_t prunedListenersCount = 0;
+		bool isUnsubscribed = false;
+
+		TSubscriptionHandle lastHandle = TSubscriptionHandle::Invalid;
+
+		testDelegate.Subscribe([&]
+		{
+			if (!pOwner)
+			{
+				return;
+			}
+
+			pOwner.reset();
+
+			prunedListenersCount = testDelegate.PruneExpiredListeners();
+			isUnsubscribed = testDelegate.Unsubscribe(lastHandle);
+		});
+
+		testDelegate.SubscribeWeak(std::weak_ptr<int>(pOwner), [&weakListenerCallsCount] { ++weakListenerCallsCount; });
+		lastHandle = testDelegate.Subscribe([&lastListenerCallsCount] { ++lastListenerCallsCount; });
+
+		testDelegate.Notify();
+		testDelegate.Notify();
+
+		REQUIRE(prunedListenersCount == 1);
+		REQUIRE(isUnsubscribed);
+		REQUIRE(weakListenerCallsCount == 0);
+		REQUIRE(lastListenerCallsCount <= 1);
+		REQUIRE(testDelegate.PruneExpiredListeners() == 0);
+	}
+
+	SECTION("TestNotify_UnsubscribeListenerFromItself_DoesNotDeadlock")
+	{
+		Delegate<float> testDelegate;
+
+		uint32_t callsCount = 0;
+		TSubscriptionHandle handle = TSubscriptionHandle::Invalid;
+
+		handle = testDelegate.Subscribe([&](float)
+		{
+			++callsCount;
+			REQUIRE(testDelegate.Unsubscribe(handle));
+		});
+
+		testDelegate.Notify(0.0f);
+		testDelegate.Notify(0.0f);
+
+		REQUIRE(callsCount == 1);
+	}
+
+	SECTION("TestNotify_SubscribeNewListenerFromListener_NewListenerIsInvokedWithinNextNotification")
+	{
+		Delegate<> testDelegate;
+
+		uint32_t newListenerCallsCount = 0;
+
+		testDelegate.Subscribe([&]
+		{
+			testDelegate.Subscribe([&] { ++newListenerCallsCount; });
+		});
+
+		testDelegate.Notify();
+		REQUIRE(newListenerCallsCount == 0);
+
+		testDelegate.Notify();
+		REQUIRE(newListenerCallsCount == 1);
+	}
+
+	SECTION("TestNotify_UnsubscribeNextListenerFromListener_ItIsInvokedWithinCurrentNotificationOnly")
+	{
+		Delegate<> testDelegate;
+
+		uint32_t secondListenerCallsCount = 0;
+		TSubscriptionHandle secondHandle = TSubscriptionHandle::Invalid;
+
+		testDelegate.Subscribe([&] { testDelegate.Unsubscribe(secondHandle); });
+		secondHandle = testDelegate.Subscribe([&] { ++secondListenerCallsCount; });
+
+		testDelegate.Notify();
+		testDelegate.Notify();
+
+		REQUIRE(secondListenerCallsCount == 1);
+	}
+
+	SECTION("TestNotify_NotifyAndUnsubscribeAllFromListener_NestedNotificationIsDeliveredAndListenersAreRemoved")
+	{
+		Delegate<int> testDelegate;
+
+		std::vector<int> receivedValues;
+
+		testDelegate.Subscribe([&](int value)
+		{
+			receivedValues.push_back(value);
+
+			if (value > 0)
+			{
+				testDelegate.Notify(value - 1);
+				testDelegate.UnsubscribeAll();
+			}
+		});
+
+		testDelegate.Notify(2);
+		testDelegate.Notify(2);
+
+		REQUIRE(receivedValues == std::vector<int> { 2, 1, 0 });
+	}
+
+	SECTION("TestNotify_ReserveFromListener_RestListenersAreInvoked")
+	{
+		Delegate<> testDelegate;
+
+		uint32_t callsCount = 0;
+
+		testDelegate.Subscribe([&]
+		{
+			++callsCount;
+			testDelegate.Reserve(1024);
+		});
+
+		for (int i = 0; i < 3; ++i)
+		{
+			testDelegate.Subscribe([&callsCount] { ++callsCount; });
+		}
+
+		testDelegate.Notify();
+		testDelegate.Notify();
+
+		REQUIRE(callsCount == 8);
+	}
+}
+
+
+#if DELEGATE_ENABLE_THREAD_SAFENESS
+
+TEST_CASE("Test Delegate's concurrency")
+{
+	SECTION("TestNotify_InvokeFromFewThreadsWhileSubscribing_AllNotificationsAreDelivered")
+	{
+		constexpr uint32_t threadsCount = 4;
+		constexpr uint32_t notificationsPerThread = 1000;
+
+		Delegate<int> testDelegate;
+
+		std::atomic<uint32_t> callsCount { 0 };
+		testDelegate.Subscribe([&callsCount](int) { ++callsCount; });
+
+		std::vector<std::thread> notifiers;
+
+		for (uint32_t i = 0; i < threadsCount; ++i)
+		{
+			notifiers.emplace_back([&testDelegate]
+			{
+				for (uint32_t j = 0; j < notificationsPerThread; ++j)
+				{
+					testDelegate.Notify(static_cast<int>(j));
+				}
+			});
+		}
+
+		for (uint32_t i = 0; i < notificationsPerThread; ++i)
+		{
+			testDelegate.Unsubscribe(testDelegate.Subscribe([](int) {}));
+		}
+
+		for (auto&& currThread : notifiers)
+		{
+			currThread.join();
+		}
+
+		REQUIRE(callsCount == threadsCount * notificationsPerThread);
+	}
+}
+
+
+
+TEST_CASE("Test Delegate's parallel notification")
+{
+	DelegateThreadPool threadPool(3);
+
+	SECTION("TestNotifyParallel_PassManyListeners_EachOneIsInvokedOnce")
+	{
+		constexpr uint32_t listenersCount = 200;
+
+		std::vector<std::atomic<uint32_t>> callsCounters(listenersCount);
+		std::atomic<int> sum { 0 };
+
+		Delegate<int> testDelegate;
+
+		for (uint32_t i = 0; i < listenersCount; ++i)
+		{
+			std::atomic<uint32_t>* pCounter = &callsCounters[i];
+
+			testDelegate.Subscribe([pCounter, &sum](int value) 
+			{
+				++(*pCounter);
+				sum += value;
+			});
+		}
+
+		testDelegate.NotifyParallel(threadPool, 2);
+		testDelegate.NotifyParallel(threadPool, 2);
+
+		REQUIRE(sum == 4 * listenersCount);
+		REQUIRE(std::all_of(callsCounters.cbegin(), callsCounters.cend(), [](const std::atomic<uint32_t>& counter) { return counter == 2; }));
+	}
+
+	SECTION("TestNotifyParallel_InvokeNestedParallelNotification_NestedOneIsExecutedWithoutDeadlock")
+	{
+		std::atomic<uint32_t> innerCallsCount { 0 };
+
+		Delegate<> innerDelegate;
+
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			innerDelegate.Subscribe([&innerCallsCount] { ++innerCallsCount; });
+		}
+
+		Delegate<> outerDelegate;
+
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			outerDelegate.Subscribe([&] { innerDelegate.NotifyParallel(threadPool); });
+		}
+
+		outerDelegate.NotifyParallel(threadPool);
+
+		REQUIRE(innerCallsCount == 64);
+	}
+}
+
+
+TEST_CASE("Test QueuedDelegate")
+{
+	SECTION("TestPost_PostFewEvents_ListenersAreInvokedOnlyWithinDispatchInOrder")
+	{
+		QueuedDelegate<int> testDelegate(4);
+
+		std::vector<int> receivedValues;
+		testDelegate.Subscribe([&receivedValues](int value) { receivedValues.push_back(value); });
+
+		REQUIRE(testDelegate.Post(1));
+		REQUIRE(testDelegate.Post(2));
+		REQUIRE(testDelegate.Post(3));
+
+		REQUIRE(receivedValues.empty());
+		REQUIRE(testDelegate.GetPendingEventsCount() == 3);
+
+		REQUIRE(testDelegate.Dispatch() == 3);
+		REQUIRE(receivedValues == std::vector<int> { 1, 2, 3 });
+		REQUIRE(testDelegate.GetPendingEventsCount() == 0);
+	}
+
+	SECTION("TestPost_OverflowQueueWithDropPolicy_NewEventsAreDiscarded")
+	{
+		QueuedDelegate<int> testDelegate(2, E_QUEUE_OVERFLOW_POLICY::DROP);
+
+		std::vector<int> receivedValues;
+		testDelegate.Subscribe([&receivedValues](int value) { receivedValues.push_back(value); });
+
+		REQUIRE(testDelegate.Post(1));
+		REQUIRE(testDelegate.Post(2));
+		REQUIRE(!testDelegate.Post(3));
+
+		testDelegate.Dispatch();
+		REQUIRE(receivedValues == std::vector<int> { 1, 2 });
+	}
+
+	SECTION("TestPost_OverflowQueueWithOverwritePolicy_OldestEventsAreDiscarded")
+	{
+		QueuedDelegate<std::string> testDelegate(2, E_QUEUE_OVERFLOW_POLICY::OVERWRITE);
+
+		std::vector<std::string> receivedValues;
+		testDelegate.Subscribe([&receivedValues](std::string value) { receivedValues.push_back(value); });
+
+		REQUIRE(testDelegate.Post("first"));
+		REQUIRE(testDelegate.Post("second"));
+		REQUIRE(testDelegate.Post("third"));
+
+		REQUIRE(testDelegate.Dispatch(1) == 1);
+		REQUIRE(testDelegate.Dispatch() == 1);
+		REQUIRE(receivedValues == std::vector<std::string> { "second", "third" });
+	}
+
+	SECTION("TestPost_PostWithBlockPolicyAndDispatchThread_AllEventsAreDelivered")
+	{
+		constexpr int eventsCount = 1000;
+
+		std::atomic<int> sum { 0 };
+
+		{
+			QueuedDelegate<int> testDelegate(8, E_QUEUE_OVERFLOW_POLICY::BLOCK);
+			testDelegate.Subscribe([&sum](int value) { sum += value; });
+
+			testDelegate.StartDispatchThread();
+
+			for (int i = 1; i <= eventsCount; ++i)
+			{
+				REQUIRE(testDelegate.Post(i));
+			}
+
+			testDelegate.StopDispatchThread();
+		}
+
+		REQUIRE(sum == eventsCount * (eventsCount + 1) / 2);
+	}
+}
+
+#endif
+
+TEST_CASE("Test CoalescingDelegate")
+{
+	using TTestDelegate = CoalescingDelegate<std::string, std::string, int>;
+
+	std::vector<int> receivedValues;
+
+	SECTION("TestPost_PostEventsWithSameKey_TheyAreCollapsedIntoLastOne")
+	{
+		TTestDelegate testDelegate(std::chrono::hours(1));
+		testDelegate.Subscribe([&receivedValues](std::string, int value) { receivedValues.push_back(value); });
+
+		REQUIRE(testDelegate.Post("config", "config", 1));
+		REQUIRE(testDelegate.Post("cache", "cache", 10));
+		REQUIRE(!testDelegate.Post("config", "config", 2));
+		REQUIRE(!testDelegate.Post("config", "config", 3));
+
+		REQUIRE(testDelegate.Dispatch() == 0);
+		REQUIRE(testDelegate.GetPendingEventsCount() == 2);
+		REQUIRE(testDelegate.GetCoalescedEventsCount() == 2);
+
+		REQUIRE(testDelegate.Dispatch(TTestDelegate::TClock::now() + std::chrono::hours(2)) == 2);
+		REQUIRE(receivedValues == std::vector<int> { 3, 10 });
+
+		REQUIRE(testDelegate.Post("config", "config", 4));
+		REQUIRE(testDelegate.Flush() == 1);
+		REQUIRE(receivedValues == std::vector<int> { 3, 10, 4 });
+	}
+
+	SECTION("TestPost_PassCustomMergeFunction_PendingEventsAreMerged")
+	{
+		TTestDelegate testDelegate(std::chrono::hours(1), [](TTestDelegate::TEvent& pendingEvent, TTestDelegate::TEvent&& newEvent)
+		{
+			std::get<1>(pendingEvent) += std::get<1>(newEvent);
+		});
+
+		testDelegate.Subscribe([&receivedValues](std::string, int value) { receivedValues.push_back(value); });
+
+		for (int i = 1; i <= 4; ++i)
+		{
+			testDelegate.Post("dirty", "dirty", i);
+		}
+
+		REQUIRE(testDelegate.Flush() == 1);
+		REQUIRE(receivedValues == std::vector<int> { 10 });
+	}
+}
+
+TEST_CASE("Test RateLimitedDelegate")
+{
+	SECTION("TestTryConsume_ConsumeAllTokens_RefillsThemWithTime")
+	{
+		const auto startTime = TokenBucket::TClock::now();
+
+		TokenBucket tokenBucket(2.0, 2.0, startTime);
+
+		REQUIRE(tokenBucket.TryConsume(startTime));
+		REQUIRE(tokenBucket.TryConsume(startTime));
+		REQUIRE(!tokenBucket.TryConsume(startTime));
+
+		REQUIRE(tokenBucket.TryConsume(startTime + std::chrono::milliseconds(500)));
+		REQUIRE(!tokenBucket.TryConsume(startTime + std::chrono::milliseconds(500)));
+
+		REQUIRE(tokenBucket.TryConsume(startTime + std::chrono::seconds(10)));
+		REQUIRE(tokenBucket.TryConsume(startTime + std::chrono::seconds(10)));
+		REQUIRE(!tokenBucket.TryConsume(startTime + std::chrono::seconds(10)));
+	}
+
+	SECTION("TestNotify_ExceedBurstSize_ExtraEventsAreDropped")
+	{
+		int callsCount = 0;
+
+		RateLimitedDelegate<int> testDelegate(0.001, 3.0);
+		testDelegate.Subscribe([&callsCount](int) { ++callsCount; });
+
+		for (int i = 0; i < 10; ++i)
+		{
+			testDelegate.Notify(i);
+		}
+
+		REQUIRE(callsCount == 3);
+		REQUIRE(testDelegate.GetDroppedEventsCount() == 7);
+	}
+}
@@ -0,0 +1,209 @@
+#include "eventBus.hpp" // goes first to make sure the header is self-contained
+#include <catch2/catch.hpp>
+#include <memory>
+#include <thread>
+#include <string>
+
+
+using namespace Wrench;
+
+
+namespace
+{
+	struct TIntEvent
+	{
+		int mValue;
+	};
+
+	struct TStringEvent
+	{
+		std::string mValue;
+	};
+
+	using TTestEventBus = EventBus<TIntEvent, TStringEvent>;
+}
+
+
+TEST_CASE("Test EventBus")
+{
+	TTestEventBus eventBus;
+
+	SECTION("TestNotify_PassEventsOfDifferentTypes_InvokesListenersOfCorrespondingChannelsOnly")
+	{
+		int intSum = 0;
+		std::string concatenatedStr;
+
+		eventBus.Subscribe<TIntEvent>([&intSum](const TIntEvent& event) { intSum += event.mValue; });
+		eventBus.Subscribe<TStringEvent>([&concatenatedStr](const TStringEvent& event) { concatenatedStr += event.mValue; });
+
+		eventBus.Notify(TIntEvent { 2 });
+		eventBus.Notify(TStringEvent { "foo" });
+		eventBus.Notify(TIntEvent { 3 });
+
+		REQUIRE(intSum == 5);
+		REQUIRE(concatenatedStr == "foo");
+		REQUIRE(eventBus.GetStats<TIntEvent>().mDispatchedCount == 2);
+		REQUIRE(eventBus.GetStats<TStringEvent>().mDispatchedCount == 1);
+	}
+
+	SECTION("TestPublish_PublishEvents_TheyAreDispatchedOnTickInOrder")
+	{
+		std::vector<int> receivedValues;
+
+		eventBus.Subscribe<TIntEvent>([&receivedValues](const TIntEvent& event) { receivedValues.push_back(event.mValue); });
+
+		eventBus.Publish(TIntEvent { 1 });
+		eventBus.Publish(TIntEvent { 2 });
+
+		REQUIRE(receivedValues.empty());
+		REQUIRE(eventBus.GetStats<TIntEvent>().mPublishedCount == 2);
+		REQUIRE(eventBus.GetStats<TIntEvent>().mDispatchedCount == 0);
+
+		REQUIRE(eventBus.Tick() == 2);
+		REQUIRE(receivedValues == std::vector<int> { 1, 2 });
+		REQUIRE(eventBus.GetStats<TIntEvent>().mDispatchedCount == 2);
+
+		REQUIRE(eventBus.Tick() == 0);
+	}
+
+	SECTION("TestPublish_PublishEventFromListener_ItIsDispatchedOnNextTick")
+	{
+		int callsCount = 0;
+
+		eventBus.Subscribe<TIntEvent>([&](const TIntEvent& event)
+		{
+			++callsCount;
+
+			if (event.mValue > 0)
+			{
+				eventBus.Publish(TIntEvent { event.mValue - 1 });
+			}
+		});
+
+		eventBus.Publish(TIntEvent { 2 });
+
+		REQUIRE(eventBus.Tick() == 1);
+		REQUIRE(eventBus.Tick() == 1);
+		REQUIRE(eventBus.Tick() == 1);
+		REQUIRE(eventBus.Tick() == 0);
+		REQUIRE(callsCount == 3);
+	}
+
+	SECTION("TestPublish_PublishEventOfAnotherTypeFromListener_ItIsDispatchedOnNextTick")
+	{
+		std::vector<std::string> receivedEvents;
+
+		eventBus.Subscribe<TIntEvent>([&](const TIntEvent& event)
+		{
+			receivedEvents.push_back(std::to_string(event.mValue));
+			eventBus.Publish(TStringEvent { "foo" });
+		});
+
+		eventBus.Subscribe<TStringEvent>([&](const TStringEvent& event)
+		{
+			receivedEvents.push_back(event.mValue);
+			eventBus.Publish(TIntEvent { 2 });
+		});
+
+		eventBus.Publish(TIntEvent { 1 });
+
+		REQUIRE(eventBus.Tick() == 1);
+		REQUIRE(receivedEvents == std::vector<std::string> { "1" });
+
+		REQUIRE(eventBus.Tick() == 1);
+		REQUIRE(receivedEvents == std::vector<std::string> { "1", "foo" });
+
+		REQUIRE(eventBus.Tick() == 1);
+		REQUIRE(receivedEvents == std::vector<std::string> { "1", "foo", "2" });
+	}
+
+	SECTION("TestTick_PublishEventsFromExitedThreads_TheirQueuesAreReleased")
+	{
+		int receivedCount = 0;
+
+		eventBus.Subscribe<TIntEvent>([&receivedCount](const TIntEvent&) { ++receivedCount; });
+
+		for (int i = 0; i < 3; ++i)
+		{
+			std::thread([&eventBus] { eventBus.Publish(TIntEvent { 1 }); }).join();
+		}
+
+		eventBus.Publish(TIntEvent { 1 });
+
+		REQUIRE(eventBus.GetThreadQueuesCount() == 4);
+		REQUIRE(eventBus.Tick() == 4);
+		REQUIRE(receivedCount == 4);
+		REQUIRE(eventBus.GetThreadQueuesCount() == 1);
+	}
+
+	SECTION("TestPublish_PublishIntoSeveralBusesInTurn_EachBusDispatchesItsOwnEvents")
+	{
+		const int busesCount = 6;
+
+		std::vector<std::unique_ptr<TTestEventBus>> buses;
+		std::vector<int> sums(busesCount, 0);
+
+		for (int i = 0; i < busesCount; ++i)
+		{
+			buses.emplace_back(new TTestEventBus());
+			buses.back()->Subscribe<TIntEvent>([&sums, i](const TIntEvent& event) { sums[i] += event.mValue; });
+		}
+
+		for (int j = 0; j < 3; ++j)
+		{
+			for (int i = 0; i < busesCount; ++i)
+			{
+				buses[i]->Publish(TIntEvent { i + 1 });
+			}
+		}
+
+		for (int i = 0; i < busesCount; ++i)
+		{
+			REQUIRE(buses[i]->Tick() == 3);
+			REQUIRE(sums[i] == 3 * (i + 1));
+			REQUIRE(buses[i]->GetThreadQueuesCount() == 1);
+		}
+	}
+
+	SECTION("TestPublish_PublishEventsFromSeveralThreads_AllOfThemAreDispatchedWithinSingleTick")
+	{
+		const int threadsCount = 4;
+		const int eventsPerThread = 1000;
+
+		int sum = 0;
+		size_t batchesCount = 0;
+
+		eventBus.SubscribeBatch<TIntEvent>([&](TSpan<TIntEvent> events)
+		{
+			++batchesCount;
+
+			for (auto&& currEvent : events)
+			{
+				sum += currEvent.mValue;
+			}
+		});
+
+		std::vector<std::thread> threads;
+
+		for (int i = 0; i < threadsCount; ++i)
+		{
+			threads.emplace_back([&eventBus]
+			{
+				for (int j = 0; j < eventsPerThread; ++j)
+				{
+					eventBus.Publish(TIntEvent { 1 });
+				}
+			});
+		}
+
+		for (auto&& currThread : threads)
+		{
+			currThread.join();
+		}
+
+		REQUIRE(eventBus.Tick() == threadsCount * eventsPerThread);
+		REQUIRE(sum == threadsCount * eventsPerThread);
+		REQUIRE(batchesCount == 1);
+		REQUIRE(eventBus.GetStats<TIntEvent>().mPublishedCount == threadsCount * eventsPerThread);
+	}
+}
@@ -1,5 +1,7 @@
 #include <catch2/catch.hpp>
 #include "result.hpp"
+#include <memory>
+#include <vector>
 
 
 using namespace Wrench;
@@ -17,6 +19,41 @@ struct TScopeGuard
 };
 
 
+namespace
+{
+	Result<int, std::string> ParseDigit(char ch)
+	{
+		if (ch < '0' || ch > '9')
+		{
+			return Err(std::string("not a digit"));
+		}
+
+		return Ok(ch - '0');
+	}
+
+	Result<int, std::string> ParseTwoDigits(const std::string& str)
+	{
+		WRENCH_TRY(str.size() == 2 ? Result<void, std::string>::Ok() : Result<void, std::string>::Err("wrong length"));
+
+		WRENCH_TRY_ASSIGN(const int high, ParseDigit(str[0]));
+		WRENCH_TRY_ASSIGN(const int low, ParseDigit(str[1]));
+
+		return Ok(high * 10 + low);
+	}
+}
+
+
+struct TCopyCounter
+{
+	TCopyCounter(uint32_t& copiesCount, int value) : mpCopiesCount(&copiesCount), mValue(value) {}
+	TCopyCounter(const TCopyCounter& other) : mpCopiesCount(other.mpCopiesCount), mValue(other.mValue) { ++(*mpCopiesCount); }
+	TCopyCounter(TCopyCounter&& other) = default;
+
+	uint32_t* mpCopiesCount;
+	int mValue;
+};
+
+
 TEST_CASE("Result<T,E> Tests")
 {
 	SECTION("TestConstructor_CreateValueObjects_CorrectlyInitializesThem")
@@ -39,4 +76,124 @@ TEST_CASE("Result<T,E> Tests")
 		REQUIRE(!Result<int, int>(TErrValue<int>(42)).IsOk());
 	}
 
+	SECTION("TestConstructor_CopyAndMoveResults_ValuesAreCorrectlyCopiedAndMoved")
+	{
+		const std::vector<int> expectedValues { 1, 2, 3 };
+
+		Result<std::vector<int>, std::string> original = Ok(expectedValues);
+		Result<std::vector<int>, std::string> copy = original;
+
+		REQUIRE((copy.IsOk() && copy.Get() == expectedValues));
+
+		Result<std::vector<int>, std::string> moved = std::move(copy);
+		REQUIRE(moved.Get() == expectedValues);
+
+		moved = Err(std::string("error"));
+		REQUIRE((moved.HasError() && moved.GetError() == "error"));
+
+		moved = original;
+		REQUIRE(moved.Get() == expectedValues);
+
+		Result<void, std::string> voidResult = Ok();
+		REQUIRE(voidResult.IsOk());
+
+		voidResult = Result<void, std::string>::Err("error");
+		REQUIRE(voidResult.GetError() == "error");
+	}
+
+	SECTION("TestFactories_ConstructAndReturnResults_NoCopiesAreMade")
+	{
+		uint32_t copiesCount = 0;
+
+		auto makeResult = [&copiesCount](bool isOk)
+		{
+			return isOk ? Result<TCopyCounter, int>::Ok(copiesCount, 42) : Result<TCopyCounter, int>::Err(-1);
+		};
+
+		Result<TCopyCounter, int> result = makeResult(true);
+		REQUIRE(result.Get().mValue == 42);
+
+		TCopyCounter value = std::move(result).Get();
+		REQUIRE(value.mValue == 42);
+
+		REQUIRE(makeResult(true).Unwrap().mValue == 42);
+		REQUIRE(makeResult(false).GetError() == -1);
+
+		Result<TCopyCounter, int> other = Ok(TCopyCounter(copiesCount, 1));
+		REQUIRE(other.Get().mValue == 1);
+
+		REQUIRE(copiesCount == 0);
+	}
+
+	SECTION("TestConstructor_PassMoveOnlyValue_ItIsMovedThrough")
+	{
+		Result<std::unique_ptr<int>, int> result = Ok(std::make_unique<int>(42));
+
+		std::unique_ptr<int> pValue = std::move(result).Unwrap();
+		REQUIRE(*pValue == 42);
+	}
+
+	SECTION("TestCombinators_ChainFallibleSteps_ValuesAndErrorsArePassedThrough")
+	{
+		auto half = [](int value) -> Result<int, std::string>
+		{
+			return (value % 2) ? Result<int, std::string>::Err("odd") : Result<int, std::string>::Ok(value / 2);
+		};
+
+		REQUIRE(ParseDigit('8').Map([](int value) { return value + 1; }).Get() == 9);
+		REQUIRE(ParseDigit('8').AndThen(half).AndThen(half).Get() == 2);
+		REQUIRE(ParseDigit('6').AndThen(half).AndThen(half).GetError() == "odd");
+		REQUIRE(ParseDigit('x').Map([](int value) { return value + 1; }).GetError() == "not a digit");
+
+		REQUIRE(ParseDigit('x').MapError([](const std::string& error) { return error.size(); }).GetError() == 11);
+		REQUIRE(ParseDigit('x').OrElse([](const std::string&) { return Result<int, int>::Ok(0); }).Get() == 0);
+		REQUIRE(ParseDigit('1').OrElse([](const std::string&) { return Result<int, int>::Ok(0); }).Get() == 1);
+
+		REQUIRE(ParseDigit('x').ValueOr(-1) == -1);
+		REQUIRE(ParseDigit('3').ValueOr(-1) == 3);
+
+		Result<double, int> doubleResult = Ok(3.5);
+		const double altValue = 1.5;
+
+		REQUIRE(doubleResult.ValueOr(0) == 3.5);
+		REQUIRE(doubleResult.ValueOr(altValue) == 3.5);
+		REQUIRE(doubleResult.GetOrDefault(0) == 3.5);
+		REQUIRE(doubleResult.GetOrDefault(altValue) == 3.5);
+
+		Result<double, int> doubleError = Err(1);
+
+		REQUIRE(doubleError.ValueOr(2) == 2.0);
+		REQUIRE(doubleError.ValueOr(altValue) == 1.5);
+		REQUIRE(doubleError.GetOrDefault(altValue) == 1.5);
+		REQUIRE(Result<std::string, int>(Err(1)).ValueOr("foo") == "foo");
+
+		const Result<std::string, int> strResult = Ok(std::string("foo"));
+		REQUIRE(strResult.Map([](const std::string& str) { return str.size(); }).Get() == 3);
+		REQUIRE(strResult.Get() == "foo");
+
+		bool hasInvoked = false;
+		REQUIRE(Result<void, int>(Ok()).Map([&hasInvoked] { hasInvoked = true; }).IsOk());
+		REQUIRE(hasInvoked);
+	}
+
+	SECTION("TestCombinators_ChainTemporaryResults_ValuesAreMovedWithoutCopies")
+	{
+		uint32_t copiesCount = 0;
+
+		const int value = Result<TCopyCounter, int>::Ok(copiesCount, 1)
+			.Map([](TCopyCounter&& counter) { counter.mValue += 1; return std::move(counter); })
+			.AndThen([](TCopyCounter&& counter) { return Result<TCopyCounter, int>::Ok(std::move(counter)); })
+			.MapError([](int error) { return error; })
+			.Unwrap().mValue;
+
+		REQUIRE(value == 2);
+		REQUIRE(copiesCount == 0);
+	}
+
+	SECTION("TestTry_ParseStrings_ErrorsAreReturnedEarly")
+	{
+		REQUIRE(ParseTwoDigits("42").Get() == 42);
+		REQUIRE(ParseTwoDigits("4x").GetError() == "not a digit");
+		REQUIRE(ParseTwoDigits("421").GetError() == "wrong length");
+	}
 }
\ No newline at end of file
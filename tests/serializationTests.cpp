@@ -0,0 +1,181 @@
+#include "serialization.hpp" // goes first to make sure the header is self-contained
+#include <catch2/catch.hpp>
+#include <string>
+#include <vector>
+
+
+using namespace Wrench;
+
+
+TEST_CASE("Serialization Tests")
+{
+	std::vector<uint8_t> buffer;
+	BinaryWriter writer(buffer);
+
+	SECTION("TestVariant_WriteAndReadVariants_ValuesAreRestored")
+	{
+		using TTestVariant = Variant<int, std::string, std::vector<float>>;
+
+		writer.Write(TTestVariant(42));
+		writer.Write(TTestVariant(std::string("foo")));
+		writer.Write(TTestVariant(std::vector<float> { 1.0f, 2.0f }));
+
+		BinaryReader reader(buffer);
+
+		TTestVariant value;
+
+		REQUIRE((reader.Read(value) && value == TTestVariant(42)));
+		REQUIRE((reader.Read(value) && value == TTestVariant(std::string("foo"))));
+		REQUIRE((reader.Read(value) && value == TTestVariant(std::vector<float> { 1.0f, 2.0f })));
+		REQUIRE(reader.GetRemainingSize() == 0);
+		REQUIRE(!reader.Read(value));
+	}
+
+	SECTION("TestVariant_WriteSmallVariant_TagIsSingleByte")
+	{
+		writer.Write(Variant<char, bool>('a'));
+
+		REQUIRE(buffer.size() == 2);
+		REQUIRE(buffer[0] == 0);
+	}
+
+	SECTION("TestVariant_ReadCorruptedData_ReturnsFalse")
+	{
+		writer.Write(Variant<int, float>(1.0f));
+		buffer[0] = 5; // there is no alternative with such index
+
+		BinaryReader reader(buffer);
+		Variant<int, float> value;
+
+		REQUIRE(!reader.Read(value));
+
+		BinaryReader truncatedReader(buffer.data(), buffer.size() - 1);
+		REQUIRE(!truncatedReader.Read(value));
+	}
+
+	SECTION("TestVariant_ReadCorruptedArray_ReturnsFalse")
+	{
+		using TTestVariant = Variant<int, float>;
+
+		writer.Write(std::vector<TTestVariant> { 1, 2.0f });
+
+		/// \note The count is followed by the first variant's int value and its type index
+		buffer[sizeof(uint32_t) + sizeof(int)] = 0xFF;
+
+		std::vector<TTestVariant> values;
+
+		BinaryReader reader(buffer);
+		REQUIRE(!reader.Read(values));
+		REQUIRE(values.empty());
+
+		uint32_t count = 0;
+
+		BinaryReader viewReader(buffer);
+		REQUIRE(!viewReader.ReadArrayView<TTestVariant>(count));
+	}
+
+	SECTION("TestRead_ReadCorruptedBools_ReturnsFalse")
+	{
+		using TTestVariant = Variant<bool, int>;
+
+		writer.Write(true);
+		buffer[0] = 2;
+
+		bool value = false;
+		REQUIRE(!BinaryReader(buffer).Read(value));
+
+		buffer.clear();
+		writer.Write(std::vector<TTestVariant> { false, 1 });
+
+		/// \note The count is followed by the first variant's bool value
+		buffer[sizeof(uint32_t)] = 2;
+
+		std::vector<TTestVariant> values;
+
+		BinaryReader reader(buffer);
+		REQUIRE(!reader.Read(values));
+		REQUIRE(values.empty());
+
+		uint32_t count = 0;
+
+		BinaryReader viewReader(buffer);
+		REQUIRE(!viewReader.ReadArrayView<TTestVariant>(count));
+	}
+
+	SECTION("TestBoxed_ReadIntoEmptyBox_ValueIsRestored")
+	{
+		writer.Write(Boxed<std::string>(std::string("foo")));
+
+		Boxed<std::string> source(std::string("bar"));
+		Boxed<std::string> value(std::move(source));
+
+		BinaryReader reader(buffer);
+
+		REQUIRE((reader.Read(source) && *source == "foo"));
+	}
+
+	SECTION("TestResult_WriteAndReadResults_ValuesAndErrorsAreRestored")
+	{
+		writer.Write(Result<std::string, int>(TOkValue<std::string>("foo")));
+		writer.Write(Result<std::string, int>(TErrValue<int>(42)));
+		writer.Write(Result<void, int>(TOkValue<void>()));
+
+		BinaryReader reader(buffer);
+
+		Result<std::string, int> result = TErrValue<int>(0);
+
+		REQUIRE((reader.Read(result) && result.IsOk() && result.Get() == "foo"));
+		REQUIRE((reader.Read(result) && result.HasError() && result.GetError() == 42));
+
+		Result<void, int> voidResult = TErrValue<int>(0);
+		REQUIRE((reader.Read(voidResult) && voidResult.IsOk()));
+	}
+
+	SECTION("TestReadView_WriteTriviallyCopyableValues_TheyAreReadWithoutCopying")
+	{
+		struct TMessage
+		{
+			uint32_t mId;
+			double   mValue;
+		};
+
+		writer.Write(static_cast<uint8_t>(1));
+		writer.Write(TMessage { 42, 1.5 });
+
+		BinaryReader reader(buffer);
+
+		uint8_t header = 0;
+		REQUIRE(reader.Read(header));
+
+		const TMessage* pMessage = reader.ReadView<TMessage>();
+
+		REQUIRE(pMessage);
+		REQUIRE(reinterpret_cast<const uint8_t*>(pMessage) >= buffer.data());
+		REQUIRE(reinterpret_cast<const uint8_t*>(pMessage) < buffer.data() + buffer.size());
+		REQUIRE((pMessage->mId == 42 && pMessage->mValue == 1.5));
+	}
+
+	SECTION("TestWriteArray_WriteArrayOfTrivialVariants_ItIsCopiedAtOnce")
+	{
+		using TTestVariant = Variant<int, float>;
+
+		const std::vector<TTestVariant> values { 1, 2.0f, 3 };
+
+		writer.Write(values);
+
+		REQUIRE(buffer.size() == sizeof(uint32_t) + sizeof(TTestVariant) * values.size());
+
+		BinaryReader reader(buffer);
+
+		uint32_t count = 0;
+		const TTestVariant* pValues = reader.ReadArrayView<TTestVariant>(count);
+
+		REQUIRE((pValues && count == 3));
+		REQUIRE(pValues[1] == TTestVariant(2.0f));
+
+		BinaryReader copyingReader(buffer);
+
+		std::vector<TTestVariant> readValues;
+		REQUIRE((copyingReader.Read(readValues) && readValues == values));
+	}
+}
@@ -1,5 +1,12 @@
 #include <catch2/catch.hpp>
 #include "variant.hpp"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unordered_set>
 
 
 using namespace Wrench;
@@ -13,6 +20,28 @@ TEST_CASE("Variant Tests")
 		REQUIRE(GetMaxSize<int>() == sizeof(int));
 	}
 
+	SECTION("TestGetMaxAlignment_PassTypes_ReturnsAlignmentOfMostAlignedOne")
+	{
+		REQUIRE(GetMaxAlignment<char, double>() == alignof(double));
+		REQUIRE(GetMaxAlignment<char>() == 1);
+	}
+
+	SECTION("TestVariantLayout_PassSmallTypes_IndexIsPackedAfterStorage")
+	{
+		struct alignas(32) TAlignedType { char mValue; };
+
+		static_assert(std::is_same<Variant<int, float>::TTypeIndex, uint8_t>::value, "The smallest index type is expected");
+		static_assert(std::is_same<TVariantIndexType<1000>::TType, uint16_t>::value, "The smallest index type is expected");
+
+		REQUIRE(sizeof(Variant<int, float>) == 2 * sizeof(int));
+		REQUIRE(sizeof(Variant<char, bool>) == 2);
+		REQUIRE(alignof(Variant<char, double>) == alignof(double));
+		REQUIRE(alignof(Variant<char, TAlignedType>) == 32);
+
+		Variant<char, TAlignedType> v = TAlignedType { 'a' };
+		REQUIRE(reinterpret_cast<uintptr_t>(&v.As<TAlignedType>()) % 32 == 0);
+	}
+
 	SECTION("TestFindType_PassTypes_ReturnIndexOfType")
 	{
 		REQUIRE(GetIndexOfType<int, float, std::string, char, int>() == 3);
@@ -74,4 +103,340 @@ TEST_CASE("Variant Tests")
 
 		REQUIRE(hasDestroyed);
 	}
-}
\ No newline at end of file
+
+	SECTION("TestVariant_CopyAndMoveNonTrivialTypes_ValuesAreCorrectlyCopiedAndMoved")
+	{
+		using TTestVariant = Variant<int, std::string, std::vector<int>>;
+
+		const std::string expectedStr(64, 'x'); /// \note The string is long enough to be allocated on the heap
+
+		TTestVariant original = expectedStr;
+		TTestVariant copy = original;
+
+		REQUIRE((copy.Is<std::string>() && copy.As<std::string>() == expectedStr));
+		REQUIRE(original.As<std::string>() == expectedStr);
+
+		TTestVariant moved = std::move(copy);
+		REQUIRE((moved.Is<std::string>() && moved.As<std::string>() == expectedStr));
+
+		moved = std::vector<int> { 1, 2, 3 };
+		REQUIRE((moved.Is<std::vector<int>>() && moved.As<std::vector<int>>() == std::vector<int> { 1, 2, 3 }));
+
+		moved = original;
+		REQUIRE(moved.As<std::string>() == expectedStr);
+
+		moved = moved.As<std::string>();
+		REQUIRE(moved.As<std::string>() == expectedStr);
+
+		TTestVariant other = 42;
+		Swap(moved, other);
+
+		REQUIRE((moved.Is<int>() && moved.As<int>() == 42));
+		REQUIRE((other.Is<std::string>() && other.As<std::string>() == expectedStr));
+	}
+
+	SECTION("TestVariant_ReassignAndDestroyVariants_EveryValueIsReleasedOnce")
+	{
+		auto pValue = std::make_shared<int>(42);
+
+		{
+			Variant<int, std::shared_ptr<int>> v = pValue;
+			REQUIRE(pValue.use_count() == 2);
+
+			Variant<int, std::shared_ptr<int>> copy = v;
+			REQUIRE(pValue.use_count() == 3);
+
+			copy = 1;
+			REQUIRE(pValue.use_count() == 2);
+
+			copy = std::move(v);
+			REQUIRE(pValue.use_count() == 2);
+		}
+
+		REQUIRE(pValue.use_count() == 1);
+	}
+
+	SECTION("TestVariant_DefaultConstruction_HoldsValueInitializedFirstAlternative")
+	{
+		Variant<std::string, int> v;
+
+		REQUIRE((v.Is<std::string>() && v.As<std::string>().empty()));
+	}
+
+	SECTION("TestVariant_PassMoveOnlyType_ValueIsMovedBetweenVariants")
+	{
+		Variant<int, std::unique_ptr<int>> v = std::make_unique<int>(42);
+
+		REQUIRE((v.Is<std::unique_ptr<int>>() && *v.As<std::unique_ptr<int>>() == 42));
+
+		Variant<int, std::unique_ptr<int>> other = std::move(v);
+		REQUIRE(*other.As<std::unique_ptr<int>>() == 42);
+
+		v = std::make_unique<int>(1);
+		Swap(v, other);
+
+		REQUIRE(*v.As<std::unique_ptr<int>>() == 42);
+		REQUIRE(*other.As<std::unique_ptr<int>>() == 1);
+	}
+
+	SECTION("TestEmplace_ConstructValuesInPlace_NoCopiesAreMade")
+	{
+		struct TCopyCounter
+		{
+			TCopyCounter(uint32_t& copiesCount, int value) : mpCopiesCount(&copiesCount), mValue(value) {}
+			TCopyCounter(const TCopyCounter& other) : mpCopiesCount(other.mpCopiesCount), mValue(other.mValue) { ++(*mpCopiesCount); }
+			TCopyCounter(TCopyCounter&& other) = default;
+			TCopyCounter& operator= (const TCopyCounter& other) { mpCopiesCount = other.mpCopiesCount; mValue = other.mValue; ++(*mpCopiesCount); return *this; }
+			TCopyCounter& operator= (TCopyCounter&& other) = default;
+
+			uint32_t* mpCopiesCount;
+			int mValue;
+		};
+
+		uint32_t copiesCount = 0;
+
+		Variant<int, TCopyCounter> v(TInPlaceType<TCopyCounter>(), copiesCount, 1);
+		REQUIRE((v.Is<TCopyCounter>() && v.As<TCopyCounter>().mValue == 1));
+
+		v = 5;
+		REQUIRE(v.Emplace<TCopyCounter>(copiesCount, 2).mValue == 2);
+
+		v = TCopyCounter(copiesCount, 3);
+		REQUIRE(v.As<TCopyCounter>().mValue == 3);
+
+		Variant<int, TCopyCounter> other = TCopyCounter(copiesCount, 4);
+		REQUIRE(other.As<TCopyCounter>().mValue == 4);
+
+		REQUIRE(copiesCount == 0);
+
+		other = v.As<TCopyCounter>();
+		REQUIRE(copiesCount == 1);
+	}
+
+	SECTION("TestComparison_CompareVariants_ComparesTypesFirstThenValues")
+	{
+		using TTestVariant = Variant<int, std::string>;
+
+		REQUIRE(TTestVariant(1) == TTestVariant(1));
+		REQUIRE(TTestVariant(1) != TTestVariant(2));
+		REQUIRE(TTestVariant(std::string("a")) == TTestVariant(std::string("a")));
+		REQUIRE(TTestVariant(0) != TTestVariant(std::string()));
+
+		REQUIRE(TTestVariant(1) < TTestVariant(2));
+		REQUIRE(TTestVariant(100) < TTestVariant(std::string("a")));
+		REQUIRE(TTestVariant(std::string("b")) > TTestVariant(std::string("a")));
+		REQUIRE(TTestVariant(1) <= TTestVariant(1));
+
+		std::vector<TTestVariant> values { std::string("b"), 3, std::string("a"), 1 };
+		std::sort(values.begin(), values.end());
+
+		REQUIRE(values == std::vector<TTestVariant> { 1, 3, std::string("a"), std::string("b") });
+	}
+
+	SECTION("TestComparison_CompareBytewiseComparableVariants_ComparesOnlyCurrentAlternative")
+	{
+		Variant<char, uint64_t> left = static_cast<uint64_t>(~0ull);
+		Variant<char, uint64_t> right = static_cast<uint64_t>(0);
+
+		left = 'a';
+		right = 'a';
+
+		REQUIRE(left == right);
+	}
+
+	SECTION("TestHash_UseVariantsAsKeys_EqualVariantsHaveSameHash")
+	{
+		using TTestVariant = Variant<int, std::string>;
+
+		std::unordered_set<TTestVariant> values { 1, std::string("a"), 1, std::string("a"), 2 };
+
+		REQUIRE(values.size() == 3);
+		REQUIRE(values.find(TTestVariant(std::string("a"))) != values.end());
+		REQUIRE(std::hash<TTestVariant>()(TTestVariant(2)) == std::hash<TTestVariant>()(TTestVariant(2)));
+	}
+
+	SECTION("TestBoxed_StoreHugeAlternative_VariantKeepsPointerOnly")
+	{
+		struct THugeStruct
+		{
+			int mValues[1024];
+		};
+
+		using TTestVariant = Variant<int, Boxed<THugeStruct>>;
+
+		static_assert(std::is_same<TBoxedIfLarger<THugeStruct>, Boxed<THugeStruct>>::value, "Huge types are expected to be boxed");
+		static_assert(std::is_same<TBoxedIfLarger<int>, int>::value, "Small types are expected to be stored inline");
+
+		REQUIRE(sizeof(TTestVariant) == 2 * sizeof(void*));
+
+		THugeStruct value {};
+		value.mValues[1023] = 42;
+
+		TTestVariant v = Boxed<THugeStruct>(value);
+		TTestVariant copy = v;
+
+		copy.As<Boxed<THugeStruct>>()->mValues[1023] = 1;
+
+		REQUIRE(v.As<Boxed<THugeStruct>>()->mValues[1023] == 42);
+		REQUIRE(copy.As<Boxed<THugeStruct>>()->mValues[1023] == 1);
+
+		const THugeStruct* pPrevValue = &v.As<Boxed<THugeStruct>>().Get();
+
+		v = 1;
+		v.Emplace<Boxed<THugeStruct>>();
+
+		REQUIRE(&v.As<Boxed<THugeStruct>>().Get() == pPrevValue); // the freed block is reused
+	}
+
+	SECTION("TestBoxed_MoveAssignBox_SourceBecomesEmpty")
+	{
+		Boxed<std::string> source(std::string("foo"));
+		Boxed<std::string> dest(std::string("bar"));
+
+		dest = std::move(source);
+
+		REQUIRE(source.IsEmpty());
+		REQUIRE(*dest == "foo");
+
+		const Boxed<std::string> copy = source;
+		REQUIRE(copy.IsEmpty());
+
+		source = dest;
+		REQUIRE((!source.IsEmpty() && *source == "foo"));
+	}
+
+	SECTION("TestBoxed_DestroyBoxAfterThreadPool_BlockIsFreedGlobally")
+	{
+		struct THugeStruct
+		{
+			explicit THugeStruct(std::atomic<int>* pDestroyedCount) : mpDestroyedCount(pDestroyedCount) {}
+			~THugeStruct() { ++*mpDestroyedCount; }
+
+			std::atomic<int>* mpDestroyedCount;
+			int mValues[1024];
+		};
+
+		std::atomic<int> destroyedCount { 0 };
+		int destroyedBeforeExitCount = 0;
+
+		std::thread([&]
+		{
+			/// \note The holder is created before the pool, so the box is destroyed when the pool is already gone
+			static thread_local std::unique_ptr<Boxed<THugeStruct>> pHolder;
+
+			pHolder.reset(new Boxed<THugeStruct>(TInPlaceType<THugeStruct>(), &destroyedCount));
+			pHolder.reset(new Boxed<THugeStruct>(TInPlaceType<THugeStruct>(), &destroyedCount));
+
+			destroyedBeforeExitCount = destroyedCount;
+		}).join();
+
+		REQUIRE(destroyedBeforeExitCount == 1);
+		REQUIRE(destroyedCount == 2);
+	}
+
+	SECTION("TestVisit_PassSingleVariant_InvokesVisitorWithCurrentValue")
+	{
+		struct TVisitor
+		{
+			std::string operator()(int value) const { return "int " + std::to_string(value); }
+			std::string operator()(float) const { return "float"; }
+			std::string operator()(const std::string& value) const { return value; }
+		};
+
+		Variant<int, float, std::string> v = 42;
+		REQUIRE(Visit(TVisitor(), v) == "int 42");
+
+		v = std::string("str");
+		REQUIRE(Visit(TVisitor(), v) == "str");
+
+		const Variant<int, float, std::string> constVariant = 1.0f;
+		REQUIRE(Visit(TVisitor(), constVariant) == "float");
+	}
+
+	SECTION("TestVisit_PassMutableVariant_VisitorModifiesValue")
+	{
+		Variant<int, double> v = 2;
+
+		Visit([](auto& value) { value *= 2; }, v);
+
+		REQUIRE(v.As<int>() == 4);
+	}
+
+	SECTION("TestVisit_PassTwoVariants_InvokesVisitorWithBothValues")
+	{
+		const auto visitor = [](const auto& left, const auto& right) { return static_cast<double>(left) - static_cast<double>(right); };
+
+		Variant<int, float, double> left = 10;
+		Variant<char, int> right = 3;
+
+		REQUIRE(Visit(visitor, left, right) == 7.0);
+
+		left = 2.5;
+		right = 'a';
+
+		REQUIRE(Visit(visitor, left, right) == 2.5 - static_cast<double>('a'));
+	}
+}
+
+TEST_CASE("VariantVector Tests")
+{
+	VariantVector<int, float, std::string> values;
+
+	values.PushBack(1);
+	values.PushBack(std::string("foo"));
+	values.PushBack(2.0f);
+	values.PushBack(3);
+	values.PushBack(Variant<int, float, std::string>(std::string("bar")));
+
+	SECTION("TestPushBack_PassValuesOfDifferentTypes_TheyAreStoredInSeparateArrays")
+	{
+		REQUIRE(values.GetSize() == 5);
+		REQUIRE(values.GetSize<int>() == 2);
+		REQUIRE(values.GetSize<float>() == 1);
+		REQUIRE(values.GetValues<int>() == std::vector<int> { 1, 3 });
+		REQUIRE(values.GetValues<std::string>() == std::vector<std::string> { "foo", "bar" });
+
+		REQUIRE((values.Is<std::string>(1) && values.As<std::string>(1) == "foo"));
+		REQUIRE((values.Is<int>(3) && values.As<int>(3) == 3));
+		REQUIRE(values.GetTypeIndex(2) == 1);
+
+		REQUIRE(values.EmplaceBack<std::string>(3, 'a') == "aaa");
+		REQUIRE(values.As<std::string>(5) == "aaa");
+	}
+
+	SECTION("TestVisit_TraverseValues_VisitsThemInInsertionOrder")
+	{
+		struct TVisitor
+		{
+			std::string& mResult;
+
+			void operator()(int value) { mResult += std::to_string(value) + " "; }
+			void operator()(float) { mResult += "float "; }
+			void operator()(const std::string& value) { mResult += value + " "; }
+		};
+
+		std::string result;
+		values.Visit(TVisitor { result });
+
+		REQUIRE(result == "1 foo float 3 bar ");
+
+		result.clear();
+		values.VisitByType(TVisitor { result });
+
+		REQUIRE(result == "1 3 float foo bar ");
+	}
+
+	SECTION("TestForEach_ModifyValuesOfSingleType_OnlyTheseValuesAreChanged")
+	{
+		values.ForEach<int>([](int& value) { value *= 10; });
+
+		REQUIRE(values.As<int>(0) == 10);
+		REQUIRE(values.As<int>(3) == 30);
+		REQUIRE(values.As<float>(2) == 2.0f);
+
+		values.Clear();
+
+		REQUIRE(values.IsEmpty());
+		REQUIRE(values.GetValues<int>().empty());
+	}
+}